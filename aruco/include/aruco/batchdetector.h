@@ -0,0 +1,130 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+
+#ifndef _ARUCO_BatchDetector_H
+#define _ARUCO_BatchDetector_H
+
+#include "aruco_export.h"
+#include "cameraparameters.h"
+#include "marker.h"
+#include "markerdetector.h"
+#include <opencv2/core.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace aruco
+{
+
+/**
+ * \brief Frames of a recorded sequence, read in order
+ */
+class ARUCO_EXPORT FrameSource
+{
+public:
+  virtual ~FrameSource()
+  {
+  }
+
+  /**
+   * Reads the next frame
+   * @param name identifies the frame in the results: the file name of an image, or the position in a video
+   * @return false when there are no more frames
+   */
+  virtual bool read(cv::Mat& frame, std::string& name) = 0;
+
+  /**
+   * Opens a folder of images, read in the order of their names, or a video file
+   * @throws cv::Exception if path can not be opened
+   */
+  static cv::Ptr<FrameSource> open(const std::string& path);
+};
+
+/**
+ * \brief Detects the markers of recorded sequences with several independent detectors running in parallel.
+ *
+ * The frames are read by the calling thread and at most maxFramesInFlight of them are in memory at a time, so that
+ * sequences of any length can be processed. If the detection mode keeps state between frames (DM_VIDEO_FAST,
+ * DM_TRACKING), each sequence is processed from its first frame by a new detector. The results are then the same as
+ * processing the sequences one after the other, and the parallelism is across sequences. Otherwise the frames of
+ * each sequence are distributed among the detectors.
+ */
+class ARUCO_EXPORT BatchDetector
+{
+public:
+  // markers of a frame
+  struct Result
+  {
+    std::size_t sequence = 0; // index of its source
+    uint64_t frame = 0; // index in the sequence, starting at 0
+    std::string name; // see FrameSource::read
+    cv::Size imageSize;
+    std::vector<Marker> markers; // with their poses, if the camera parameters and the marker size were given
+  };
+
+  /**
+   * @param configure sets up each detector (dictionary, detection mode, params) when it is created. Their
+   * Params::maxThreads is set to 1 before, since the parallelism is across frames
+   * @param workers number of detectors running in parallel. A non positive value means one per hardware thread
+   * @param maxFramesInFlight frames read and not yet passed to the sink. 0 means twice the workers
+   */
+  explicit BatchDetector(const std::function<void(MarkerDetector&)>& configure = std::function<void(MarkerDetector&)>(),
+                         int workers = -1, std::size_t maxFramesInFlight = 0);
+
+  // the poses of the markers are estimated if the camera parameters are valid and markerSize > 0 (meters)
+  void setCameraParameters(const CameraParameters& camera, float markerSize);
+
+  /**
+   * Detects the markers of all the frames of the sources. sink is called from one thread at a time, with the frames
+   * of each sequence in order. Frames of different sequences may be interleaved.
+   * The first exception thrown by a detector, a source or the sink stops the processing, and is rethrown here once
+   * all the workers have finished
+   * @return number of frames processed
+   */
+  uint64_t run(const std::vector<cv::Ptr<FrameSource>>& sources, const std::function<void(const Result&)>& sink);
+
+private:
+  // creates a detector configured and with a single thread
+  cv::Ptr<MarkerDetector> createDetector() const;
+  void detect(MarkerDetector& detector, const cv::Mat& frame, Result& result) const;
+
+  uint64_t runSequences(const std::vector<cv::Ptr<FrameSource>>& sources,
+                        const std::function<void(const Result&)>& sink);
+  uint64_t runFrames(const std::vector<cv::Ptr<FrameSource>>& sources, const std::function<void(const Result&)>& sink);
+
+  std::function<void(MarkerDetector&)> _configure;
+  int _workers;
+  std::size_t _maxFramesInFlight;
+  CameraParameters _camera;
+  float _markerSize = -1;
+};
+
+} // namespace aruco
+
+#endif // _ARUCO_BatchDetector_H
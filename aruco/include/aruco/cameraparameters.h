@@ -33,6 +33,7 @@
 #include <opencv2/core.hpp>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 namespace aruco
 {
@@ -165,6 +166,90 @@ private:
   static double dot(double a1, double a2, double a3, double b1, double b2, double b3);
 };
 
+
+/**
+ * \brief Camera parameters prepared for an image size, in the forms used by the pose estimators.
+ *
+ * The intrinsics are adjusted to the image size and kept both in float and double precision. When there is
+ * distortion, a table with the undistorted normalized coordinates of a grid of pixels is precomputed, so that image
+ * points are undistorted by interpolation instead of iteratively. An object kept between frames is only computed
+ * again when the parameters or the image size change, so that nothing is copied or converted per frame.
+ */
+class ARUCO_EXPORT PreparedCamera
+{
+public:
+  // 3x3 matrix (fx 0 cx, 0 fy cy, 0 0 1) adjusted to CamSize, CV_32F and CV_64F
+  cv::Mat CameraMatrix, CameraMatrix64;
+
+  // 1xN distortion coefficients (k1,k2,p1,p2[,k3]), CV_32F and CV_64F
+  cv::Mat Distorsion, Distorsion64;
+
+  // size of the image the parameters are prepared for
+  cv::Size CamSize;
+
+  // 1x3 matrix (Tx, Ty, Tz) of stereo cameras, CV_64F
+  cv::Mat ExtrinsicMatrix;
+
+  // translation to add to the poses, obtained from the extrinsics (zero for non-stereo cameras)
+  cv::Point3f Offset;
+
+  PreparedCamera();
+
+  /**
+   * Prepares the camera for images of the size passed, resizing the parameters if CP.CamSize is different
+   * @return true if the parameters or the size had changed since the last call, and the object has been recomputed
+   */
+  bool prepare(const CameraParameters& CP, cv::Size imageSize);
+
+  /**
+   * Prepares the camera from matrices already adjusted to the image size
+   * @param cameraMatrix 3x3 matrix (fx 0 cx, 0 fy cy, 0 0 1), float or double
+   * @param distorsionCoeff distortion coefficients, float or double. Can be empty
+   * @param extrinsics 3x1 matrix (Tx, Ty, Tz) of stereo cameras. Can be empty
+   * @return true if the parameters or the size had changed since the last call, and the object has been recomputed
+   */
+  bool prepare(const cv::Mat& cameraMatrix, const cv::Mat& distorsionCoeff, const cv::Mat& extrinsics,
+               cv::Size imageSize);
+
+  /**
+   * Indicates whether this object has been prepared
+   */
+  bool isValid() const
+  {
+    return !CameraMatrix.empty();
+  }
+
+  /**
+   * Indicates whether any distortion coefficient is not zero
+   */
+  bool hasDistortion() const
+  {
+    return _hasDistortion;
+  }
+
+  /**
+   * Undistorts the image points passed and gives their normalized coordinates, as cv::undistortPoints with the
+   * camera matrix and distortion. Points out of the image are undistorted iteratively
+   */
+  void undistortPoints(const std::vector<cv::Point2f>& points, std::vector<cv::Point2f>& normalized) const;
+
+private:
+  // distance in pixels between the nodes of the undistortion table
+  static const int TableStep = 8;
+
+  bool set(const cv::Matx33d& K, const double* D, int nD, const cv::Vec3d& T, cv::Size imageSize);
+  void buildUndistortionTable();
+
+  // values the object was last prepared from
+  cv::Matx33d _K;
+  std::vector<double> _D;
+  cv::Vec3d _T;
+
+  bool _hasDistortion;
+  // CV_32FC2, normalized coordinates of the pixels (x * TableStep, y * TableStep)
+  cv::Mat _undistortionTable;
+};
+
 } // namespace aruco
 
 #endif /* _Aruco_CameraParameters_H */
@@ -35,6 +35,7 @@
 
 #include <iostream>
 #include <map>
+#include <memory>
 #include <stdint.h>
 #include <string>
 #include <vector>
@@ -50,6 +51,9 @@ class MarkerMap;
  * Maximum size is 8x8 bits. The id is a smaller number you can use to identify it. You will use only the id
  *
  * See enum DICT_TYPES for the set of available dictionaries
+ *
+ * The codes of the predefined dictionaries are compiled in, and their lookup tables are created only the first time
+ * each one is loaded. All the instances share them read-only, so copying or loading a dictionary does not allocate
  */
 class ARUCO_EXPORT Dictionary
 {
@@ -73,7 +77,7 @@ public:
   // indicates if a code is in the dictionary
   bool is(uint64_t code) const
   {
-    return _code_id.find(code) != _code_id.end();
+    return find(code) != -1;
   }
 
   DICT_TYPES getType() const
@@ -82,10 +86,7 @@ public:
   }
 
   // return the number of ids
-  uint64_t size() const
-  {
-    return _code_id.size();
-  }
+  uint64_t size() const;
 
   // returns the total number of bits of the binary code
   uint32_t nbits() const
@@ -105,22 +106,29 @@ public:
     return _name;
   }
 
-  // return the set of ids
-  const std::map<uint64_t, uint16_t>& getMapCode() const
-  {
-    return _code_id;
-  }
+  // return the set of ids. It is created in each call, use find() to look for codes
+  std::map<uint64_t, uint16_t> getMapCode() const;
+
+  // returns the id of the code, or -1 if it is not in the dictionary
+  int find(uint64_t code) const;
 
-  // returns the id of a given code.
-  int operator[](uint64_t code)
+  /**
+   * Looks for the lowest code (as in the ordering of getMapCode()) at a hamming distance of at most maxDistance
+   * of the code passed
+   * @return true if found, and then best_code and id are set
+   */
+  bool findNearest(uint64_t code, uint32_t maxDistance, uint64_t& best_code, int& id) const;
+
+  // returns the id of a given code, -1 if it is not in the dictionary
+  int operator[](uint64_t code) const
   {
-    return _code_id[code];
+    return find(code);
   }
 
-  // returns the id of a given code.
-  int at(uint64_t code)
+  // returns the id of a given code, -1 if it is not in the dictionary
+  int at(uint64_t code) const
   {
-    return _code_id[code];
+    return find(code);
   }
 
   /**
@@ -182,14 +190,12 @@ public:
   static std::vector<std::string> getDicTypes();
 
 private:
-  void insert(uint64_t code, int id)
-  {
-    _code_id.insert(std::make_pair(code, id));
-  }
-
-  static void fromVector(const std::vector<uint64_t>& codes, std::map<uint64_t, uint16_t>& code_id_map);
+  // sorted codes and search structures, defined in dictionary.cpp
+  struct Tables;
+  static std::shared_ptr<const Tables> createTables(const uint64_t* codes, std::size_t ncodes);
+  static std::shared_ptr<const Tables> createTables(const std::map<uint64_t, uint16_t>& code_id);
 
-  std::map<uint64_t, uint16_t> _code_id; // marker have and code (internal binary code), which correspond to an id.
+  std::shared_ptr<const Tables> _tables; // marker codes (internal binary code) and their ids. Null if empty
 
   uint32_t _nbits; // total number of bits . So, there are sqrt(nbits) in each axis
   uint32_t _tau; // minimum distance between elements
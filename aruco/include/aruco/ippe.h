@@ -45,6 +45,7 @@
 
 #include <opencv2/core.hpp>
 #include "aruco_export.h"
+#include "cameraparameters.h"
 
 namespace aruco
 {
@@ -55,6 +56,19 @@ std::vector<cv::Mat> solvePnP(const std::vector<cv::Point3f>& objPoints, const s
 ARUCO_EXPORT std::vector<std::pair<cv::Mat, double> > solvePnP_(float size, const std::vector<cv::Point2f> &imgPoints,
                                                                 cv::InputArray cameraMatrix, cv::InputArray distCoeffs);
 
+/**
+ * @brief Refines a pose minimizing the reprojection error of the points with LevMarq (using a robust cost)
+ * @param r_io initial rotation vector, 1x3/3x1 float. The refined pose is left in it
+ * @param t_io initial translation vector, 1x3/3x1 float. The refined pose is left in it
+ * @return the final error
+ */
+ARUCO_EXPORT double refinePnP(const std::vector<cv::Point3f>& objPoints, const std::vector<cv::Point2f>& imgPoints,
+                              const cv::Mat& cameraMatrix, const cv::Mat& distCoeffs, cv::Mat& r_io, cv::Mat& t_io);
+
+// as above, undistorting the points with the table of the camera instead of iteratively
+ARUCO_EXPORT std::vector<std::pair<cv::Mat, double> > solvePnP_(float size, const std::vector<cv::Point2f> &imgPoints,
+                                                                const PreparedCamera &camera);
+
 std::vector<std::pair<cv::Mat, double>> solvePnP_(const std::vector<cv::Point3f>& objPoints,
                                                   const std::vector<cv::Point2f>& imgPoints,
                                                   cv::InputArray cameraMatrix, cv::InputArray distCoeffs);
@@ -33,6 +33,7 @@
 #include <Eigen/Cholesky>
 #include <functional>
 #include <iostream>
+#include <algorithm>
 #include <cmath>
 #include <ctime>
 #include <cstring>
@@ -384,6 +385,98 @@ double LevMarq<T>::solve(eVector &z, F_z_x f_z_x, F_z_J f_J)
   return currErr;
 }
 
+// Levenberg-Marquardt method as LevMarq, for problems of P parameters that compute their normal equations
+// themselves. The sizes are fixed at compile time and the problem is a template parameter instead of a
+// std::function, so that solving does not allocate memory. The problem is called as
+//   double problem(const eVector &z, eMatrix *JtJ, eVector *Jtf)
+// and must return the squared error ||f(z)||^2. If JtJ and Jtf are not null, they must be set to J^t J and J^t f(z),
+// being J the jacobian of f at z
+template<typename T, int P>
+class LevMarqFixed
+{
+public:
+  typedef Eigen::Matrix<T, P, 1> eVector;
+  typedef Eigen::Matrix<T, P, P> eMatrix;
+
+  /**
+   * @brief Constructor with params
+   * @param maxIters maximum number of iterations of the algorithm
+   * @param minError to stop the algorithm before reaching the max iterations
+   * @param min_step_error_diff minimum error difference between two iterations. If below this level, then stop.
+   * @param tau parameter indicating how near the initial solution is estimated to be to the real one. If 1, it means
+   * that it is very far and the first step will be very short. If near 0, means the opposite.
+   */
+  LevMarqFixed(int maxIters = 1000, double minError = 0, double min_step_error_diff = 0, double tau = 1) :
+      _maxIters(maxIters), _minErrorAllowed(minError), _min_step_error_diff(min_step_error_diff), _tau(tau)
+  {
+  }
+
+  /**
+   * @brief solve non linear minimization problem ||f(z)||^2
+   * @param z function params to be estimated. input-output. Contains the result of the optimization
+   * @param problem see the description of the class
+   * @return final error
+   */
+  template<typename Problem>
+  double solve(eVector &z, Problem &problem) const;
+
+private:
+  int _maxIters;
+  double _minErrorAllowed, _min_step_error_diff, _tau;
+};
+
+template<typename T, int P>
+template<typename Problem>
+double LevMarqFixed<T, P>::solve(eVector &z, Problem &problem) const
+{
+  eMatrix JtJ;
+  eVector Jtf;
+  double currErr = problem(z, &JtJ, &Jtf);
+  double mu = -1, v = 5;
+  for (int i = 0; i < _maxIters; i++)
+  {
+    eVector B = -Jtf;
+    if (mu < 0)
+      mu = JtJ.diagonal().maxCoeff() * _tau; // first time only
+
+    // same steps as LevMarq::step
+    double gain = 0, prev_mu = 0, err = 0;
+    int ntries = 0;
+    eVector estimated_z;
+    do
+    {
+      JtJ.diagonal().array() += T(mu - prev_mu); // update mu
+      prev_mu = mu;
+      eVector delta = JtJ.ldlt().solve(B);
+      estimated_z = z + delta;
+      err = problem(estimated_z, static_cast<eMatrix*>(nullptr), static_cast<eVector*>(nullptr));
+      double L = 0.5 * delta.dot(T(mu) * delta - B);
+      gain = (err - currErr) / L;
+      if (gain > 0)
+      {
+        mu = mu * std::max(double(0.33), 1. - pow(2 * gain - 1, 3));
+        v = 5.f;
+      }
+      else
+      {
+        mu = mu * v;
+        v = v * 5;
+      }
+    } while (gain <= 0 && ntries++ < 5);
+
+    // no step improves the solution
+    if (gain <= 0)
+      break;
+    double prevErr = currErr;
+    z = estimated_z;
+    currErr = err;
+    if (currErr < _minErrorAllowed || fabs(prevErr - currErr) <= _min_step_error_diff)
+      break;
+    problem(z, &JtJ, &Jtf);
+  }
+  return currErr;
+}
+
 } // namespace aruco
 
 #endif /* ARUCO_MM__LevMarq_H */
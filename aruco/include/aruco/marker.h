@@ -44,6 +44,7 @@ namespace aruco
  * \brief This class represents a marker. It is a vector of the fours corners of the marker
  */
 class CameraParameters;
+class PreparedCamera;
 
 class ARUCO_EXPORT Marker : public std::vector<cv::Point2f>
 {
@@ -54,6 +55,10 @@ public:
   float ssize;
   // rotation and translation matrices with respect to the camera
   cv::Mat Rvec, Tvec;
+  // second pose solution given by IPPE (see calculateExtrinsicsIPPE), and ratio of its reprojection error to the one
+  // of Rvec and Tvec. Ratios close to 1 mean that the pose is ambiguous. The ratio is 0 when they were not computed
+  cv::Mat Rvec2, Tvec2;
+  float poseErrorRatio;
   // additional info about the dictionary
   std::string dict_info;
 
@@ -69,6 +74,11 @@ public:
    */
   Marker(const Marker& M);
 
+  /**
+   * Moves take the buffers of M, so that sorting markers does not allocate
+   */
+  Marker(Marker&& M) = default;
+
   /**
    */
   Marker(const std::vector<cv::Point2f>& corners, int _id = -1);
@@ -117,6 +127,29 @@ public:
   void calculateExtrinsics(float markerSize, cv::Mat CameraMatrix, cv::Mat Distorsion = cv::Mat(), cv::Mat Extrinsics = cv::Mat(),
                            bool setYPerpendicular = true, bool correctFisheye = false);
 
+  /**
+   * Calculates the extrinsics (Rvec and Tvec) of the marker with respect to the camera, using the matrices already
+   * converted by the camera passed
+   * @param markerSize size of the marker side expressed in meters
+   * @param camera camera prepared for the size of the image where the marker was detected
+   * @param setYPerpendicular If set the Y axis will be perpendicular to the surface. Otherwise, it will be the Z axis
+   * @param correctFisheye Correct fisheye distortion
+   */
+  void calculateExtrinsics(float markerSize, const PreparedCamera& camera, bool setYPerpendicular = true,
+                           bool correctFisheye = false);
+
+  /**
+   * Calculates the extrinsics with IPPE, the closed-form solver for squares. Both poses that explain the corners are
+   * computed: the best one in Rvec and Tvec, the other one in Rvec2 and Tvec2, and the ratio of their errors in
+   * poseErrorRatio. Fisheye distortion is not supported
+   * @param markerSize size of the marker side expressed in meters
+   * @param camera camera prepared for the size of the image where the marker was detected
+   * @param setYPerpendicular If set the Y axis will be perpendicular to the surface. Otherwise, it will be the Z axis
+   * @param refine if set, the best pose is refined minimizing the reprojection error with LevMarq
+   */
+  void calculateExtrinsicsIPPE(float markerSize, const PreparedCamera& camera, bool setYPerpendicular = true,
+                               bool refine = false);
+
   /**
    * Given the extrinsic camera parameters returns the GL_MODELVIEW matrix for OpenGL.
    * Setting this matrix, the reference coordinate system will be set in this marker
@@ -164,6 +197,7 @@ public:
    * Compares ids
    */
   Marker & operator=(const Marker& m);
+  Marker & operator=(Marker&& m) = default;
 
   /**
    */
@@ -208,6 +242,8 @@ public:
 
 private:
   void rotateXAxis(cv::Mat& rotation);
+  // solves the pose of the corners with the camera passed, leaving it in Rvec and Tvec
+  void solvePose(float markerSize, const cv::Mat& camMatrix, const cv::Mat& distCoeff, bool correctFisheye);
 };
 
 } // namespace aruco
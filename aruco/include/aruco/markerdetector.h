@@ -31,13 +31,19 @@
 
 #include "aruco_export.h"
 #include <opencv2/core.hpp>
+#include <cstdint>
+#include <chrono>
 #include <cstdio>
+#include <functional>
 #include <iostream>
 #include <queue>
 #include <mutex>
 #include <condition_variable>
+#include <memory>
 #include <vector>
 #include "marker.h"
+#include "markerlabeler.h"
+#include "quadextractor.h"
 
 namespace aruco
 {
@@ -48,11 +54,11 @@ namespace aruco
  */
 enum DetectionMode
   : int
-  { DM_NORMAL = 0, DM_FAST = 1, DM_VIDEO_FAST = 2
+  { DM_NORMAL = 0, DM_FAST = 1, DM_VIDEO_FAST = 2, DM_TRACKING = 3
 };
 
 class CameraParameters;
-class MarkerLabeler;
+class ThreadPool;
 
 /**
  * \brief Main class for marker detection
@@ -60,9 +66,21 @@ class MarkerLabeler;
 class ARUCO_EXPORT MarkerDetector
 {
 public:
+  // THRES_ADAPTIVE_INTEGRAL applies the rule of THRES_ADAPTIVE (the window mean rounded to an integer, as OpenCV
+  // does) with means computed from an integral image built once per frame and shared among all the window sizes, so
+  // it is much faster when _AdaptiveThresWindowSize_range>0. Near the image borders the mean is computed only with
+  // the pixels inside the image instead of replicating the border, so results differ there
   enum ThresMethod
     : int
-    { THRES_ADAPTIVE = 0, THRES_AUTO_FIXED = 1
+    { THRES_ADAPTIVE = 0, THRES_AUTO_FIXED = 1, THRES_ADAPTIVE_INTEGRAL = 2
+  };
+
+  // POSE_ITERATIVE computes the pose of each marker with cv::solvePnP. POSE_IPPE uses the closed-form solver for
+  // squares, that also gives the second possible pose and the ratio of the errors of both (see Marker::Rvec2), so
+  // that ambiguous poses are detected without solving them again
+  enum PoseMethod
+    : int
+    { POSE_ITERATIVE = 0, POSE_IPPE = 1
   };
 
   /**
@@ -71,7 +89,7 @@ public:
   struct Params
   {
 
-    // maximum number of parallel threads
+    // maximum number of parallel threads, including the calling one. The workers are kept alive between frames
     int maxThreads = 1; // -1 means all
 
     // border around image limits in which corners are not allowed to be detected. (0,1)
@@ -106,12 +124,17 @@ public:
 
     // threshold methods
     ThresMethod _thresMethod = THRES_ADAPTIVE;
-    int NAttemptsAutoThresFix = 3; // number of times that tries a random threshold in case of THRES_AUTO_FIXED
+    // THRES_AUTO_FIXED: number of thresholds tried per frame. If no marker is found with the current one, the rest
+    // are chosen from the histogram of the image and tried at once (in parallel if there are workers)
+    int NAttemptsAutoThresFix = 3;
 
     // threshold parameters
     int _AdaptiveThresWindowSize = 15, _ThresHold = 10, _AdaptiveThresWindowSize_range = 0;
     // size of the image passed to the MarkerLabeler
     int _markerWarpPixSize = 5; // tau_c in paper
+    // if the labeler supports it (dictionary based ones), the cells of the candidates are read directly from the
+    // image instead of warping them. Set to false to use always the canonical images (e.g. to debug them)
+    bool sampleCells = true;
 
     // enable/disables the method for automatic size estimation for speed up
     bool _autoSize = false;
@@ -134,6 +157,79 @@ public:
     }
 
     float pyrfactor = 2;
+
+    // method used to compute the poses of the markers, when the camera parameters and marker size are given.
+    // The markers are solved in parallel. With fisheye correction POSE_ITERATIVE is always used
+    PoseMethod poseMethod = POSE_ITERATIVE;
+    // POSE_IPPE: refines the best pose minimizing the reprojection error with LevMarq
+    bool poseRefinement = false;
+
+    // DM_TRACKING: number of frames between full image scans (new markers are only found in these scans)
+    int trackingFullScanInterval = 10;
+    // DM_TRACKING: each region of interest is the bounding box of a tracked marker enlarged this fraction of its
+    // side length in every direction
+    float trackingRoiPadding = 0.5f;
+
+    // thresholds the images with the transparent API of OpenCV (cv::UMat), in the OpenCL device if there is one
+    // and OpenCV has been built with it. The image is uploaded once and only the thresholded images come back,
+    // since the rectangles are found in the host. Results may differ slightly from the default CPU path, that is
+    // used when this is false or OpenCL is not available
+    bool useOpenCL = false;
+
+    // if > 0, milliseconds the corner refinement of a frame may take. The markers whose refinement has not started
+    // by then keep their corners unrefined (only upsampled to the full image, if it was downsampled)
+    float cornerRefinementBudgetMs = 0;
+
+    // motion gate: the grey image is reduced to the mean of each block of motionGateBlockSize pixels, and compared
+    // with the means of the last frame detected there. The markers of the previous frame in the blocks that have not
+    // changed more than motionGateThreshold grey levels are kept with their poses, and the detection only runs in
+    // the regions of the changed blocks (nothing runs if none changed). The whole image is detected again every
+    // motionGateRefreshInterval frames, or when the changed blocks cover most of it
+    bool motionGate = false;
+    int motionGateBlockSize = 32;
+    int motionGateThreshold = 4;
+    int motionGateRefreshInterval = 30;
+  };
+
+  /**
+   * Time spent in each stage of a call to detect(), and the number of candidates that went through them. They are
+   * always measured (a clock read per stage) and kept for the last frames, @see getLastFrameStats
+   */
+  struct FrameStats
+  {
+    enum Stage
+      : int
+      { STAGE_CONVERT_GREY = 0, // conversion of the input to grey
+      STAGE_MOTION_GATE, // comparison of the image with the last frame detected (Params::motionGate)
+      STAGE_RESIZE, // image to threshold, downsampled according to the minimum marker size
+      STAGE_PYRAMID, // levels of the pyramid used to warp the candidates, built on demand
+      STAGE_THRESHOLD, // thresholded images and rectangles found in them
+      STAGE_PREFILTER, // removal of the candidates too near or unlikely to be markers
+      STAGE_CLASSIFICATION, // decoding of the candidates, and removal of duplicated markers
+      STAGE_CORNER_REFINEMENT, // upsampling or subpixel refinement of the corners
+      STAGE_POSE, // pose estimation, if the camera parameters are given
+      STAGE_TOTAL, // the whole call
+      NSTAGES
+    };
+
+    enum Count
+      : int
+      { COUNT_REGIONS = 0, // regions processed: the whole image, or the regions of interest (DM_TRACKING)
+      COUNT_THRESHOLD_ATTEMPTS, // thresholds tried (THRES_AUTO_FIXED tries again if nothing is found)
+      COUNT_RECTANGLES, // rectangles found in the thresholded images
+      COUNT_CANDIDATES, // candidates left by the prefilter, that are classified
+      COUNT_MARKERS, // markers detected
+      COUNT_GATE_SKIPPED, // 1 if nothing was detected because no block changed, so its mean is the skip rate
+      COUNT_GATE_REUSED, // markers of the previous frame kept because their blocks did not change
+      NCOUNTS
+    };
+
+    uint64_t frame = 0; // number of the call to detect(), starting at 1. 0 if no frame has been processed
+    double ms[NSTAGES] = {}; // milliseconds spent in each stage
+    int count[NCOUNTS] = {};
+
+    static const char* stageName(int stage);
+    static const char* countName(int count);
   };
 
   /**
@@ -171,6 +267,11 @@ public:
    * - DM_VIDEO_FAST: This is similar to DM_FAST, but specially adapted to video processing. In that case, we assume that the observed markers
    * when you call to detect() have a size similar to the ones observed in the previous frame. Then, the processing can be speeded up by employing smaller versions
    * of the image automatically calculated.
+   *
+   * - DM_TRACKING: As DM_VIDEO_FAST, but the markers detected in the previous frame are used to predict regions of
+   * interest, and the detection is only done inside them. The whole image is analyzed every
+   * Params::trackingFullScanInterval frames, when there is nothing to track, or when a tracked marker is lost.
+   * Markers appearing in the image are not reported until the next full scan.
    */
   void setDetectionMode(DetectionMode dm, float minMarkerSize = 0);
 
@@ -205,6 +306,10 @@ public:
    * If you provide information about the camera parameters and the size of the marker, then, the extrinsics of
    * the markers are detected
    *
+   * The buffers of the detector are kept between calls. Passing the same detectedMarkers vector in every call
+   * allows reusing its markers too, so that once an image of the same size has been processed, the detector itself
+   * does not allocate memory (OpenCV functions, like the pose estimation, still may)
+   *
    * @param input input color image
    * @param detectedMarkers output vector with the markers detected
    * @param camParams Camera parameters
@@ -212,7 +317,7 @@ public:
    * @param setYPerperdicular If set the Y axis will be perpendicular to the surface. Otherwise, it will be the Z axis
    * @param correctFisheye Correct fisheye distortion
    */
-  void detect(const cv::Mat& input, std::vector<Marker>& detectedMarkers, CameraParameters camParams,
+  void detect(const cv::Mat& input, std::vector<Marker>& detectedMarkers, const CameraParameters& camParams,
               float markerSizeMeters = -1, bool setYPerperdicular = false, bool correctFisheye = false);
 
   /**
@@ -290,6 +395,18 @@ public:
    */
   cv::Mat getThresholdedImage(uint32_t idx = 0);
 
+  /**
+   * Returns the stats of the last call to detect(). Can be called from any thread, even while detecting
+   */
+  FrameStats getLastFrameStats() const;
+
+  /**
+   * Returns the stats of the last frames, up to frameStatsHistorySize and from the oldest one. Can be called from
+   * any thread, even while detecting
+   */
+  std::vector<FrameStats> getFrameStatsHistory() const;
+  static const int frameStatsHistorySize = 64;
+
   ///-------------------------------------------------
   /// Methods you may not need
   /// These methods do the hard work. They have been set public in case you want to do customizations
@@ -297,6 +414,8 @@ public:
 
   /**
    * @brief setMakerLabeler sets the labeler employed to analyze the squares and extract the inner binary code
+   * If the labeler can be cloned (see MarkerLabeler::clone), the candidates are classified in parallel using a copy
+   * per thread. The copies are made after this call, so set the labeler again if you modify it afterwards
    * @param detector
    */
   void setMarkerLabeler(cv::Ptr<MarkerLabeler> detector);
@@ -304,6 +423,45 @@ public:
   {
     return markerIdDetector;
   }
+
+  /**
+   * @brief setThreadPool makes the detector use an external pool of workers, so that several detectors can share
+   * the same threads. The size of a shared pool is not modified according to Params::maxThreads.
+   * Passing an empty pointer goes back to the internal pool, created on demand.
+   */
+  void setThreadPool(cv::Ptr<ThreadPool> pool);
+  cv::Ptr<ThreadPool> getThreadPool();
+
+  /**
+   * @brief shutdownThreads stops and joins the workers of the internal pool (a shared pool is just released).
+   * If detect() is called again, the workers are created again.
+   */
+  void shutdownThreads();
+
+  /**
+   * @brief setCornerRefinementSkip sets a function telling, by the marker id, the markers whose corners must not be
+   * refined with cornerSubPix, e.g. those whose pose is refined from the previous frame by
+   * MultiMarkerPoseTracker::isTracked. It is called from the threads of the detector. An empty function refines
+   * all of them (the default)
+   */
+  void setCornerRefinementSkip(const std::function<bool(int id)> &skip)
+  {
+    _skipCornerRefinement = skip;
+  }
+
+  /**
+   * @brief setMarkerIdFilter restricts the detection to the markers accepted by the filter, e.g. the ones a node
+   * tracks. The rest are discarded as soon as they are identified (by the labeler itself if it supports it, see
+   * MarkerLabeler::setIdFilter), so their corners are not refined nor their poses estimated. With up to 64 ids, the
+   * classification of the candidates of a region stops once all of them have been found, so if a marker appears
+   * twice the copy kept is the first classified instead of the biggest. An empty filter (the default) detects every
+   * marker
+   */
+  void setMarkerIdFilter(const MarkerIdFilter &filter);
+  const MarkerIdFilter &getMarkerIdFilter() const
+  {
+    return _idFilter;
+  }
   // Represent a candidate to be a maker
   class MarkerCandidate : public Marker
   {
@@ -346,10 +504,7 @@ public:
    * Returns a list candidates to be markers (rectangles), for which no valid id was found after calling
    * detectRectangles
    */
-  std::vector<std::vector<cv::Point2f>> getCandidates() const
-  {
-    return _candidates;
-  }
+  std::vector<std::vector<cv::Point2f>> getCandidates() const;
 
   /**
    * Given the input image with markers, creates an output image with it in the canonical position
@@ -371,10 +526,27 @@ private:
 
   // pointer to the function that analyzes a rectangular region so as to detect its internal marker
   cv::Ptr<MarkerLabeler> markerIdDetector;
+  // copies of markerIdDetector for the other threads of the classification (see MarkerLabeler::clone)
+  std::vector<cv::Ptr<MarkerLabeler>> _labelerClones;
+  // creates the clones needed by nthreads, and returns how many threads can classify in parallel
+  int prepareLabelerClones(int nthreads);
+  // below this number of candidates per thread, it is not worth classifying in parallel
+  static const int minCandidatesPerThread = 8;
+  // the same for the corner refinement, per marker
+  static const int minMarkersPerThread = 4;
+  std::function<bool(int)> _skipCornerRefinement;
+  MarkerIdFilter _idFilter;
+
+  // workers running the parallel stages
+  cv::Ptr<ThreadPool> _threadPool;
+  bool _sharedThreadPool = false;
+  // returns the pool, creating or resizing it according to _params.maxThreads
+  ThreadPool &threadPool();
 
   /**
    */
   int perimeter(const std::vector<cv::Point2f> &a);
+  int perimeter(const cv::Point2f *a, std::size_t n);
 
   // auxiliary functions to perform LINES refinement
   void interpolate2Dline(const std::vector<cv::Point2f>& inPoints, cv::Point3f& outLine);
@@ -421,82 +593,94 @@ private:
         v.push_back(vv[i][j]);
   }
 
+  // markers of the previous frame and frames since the last full scan (DM_TRACKING)
+  std::vector<Marker> _trackedMarkers;
+  int _framesSinceFullScan = 0;
+  // regions of the image where the tracked markers are expected. Empty if a full scan must be done
+  std::vector<cv::Rect> getTrackingROIs(cv::Size imageSize) const;
+  // regions of the blocks changed since they were last detected (Params::motionGate), grown to contain whole the
+  // markers of the previous frame they touch. The rest of those markers are appended to reused. Returns false,
+  // leaving rois and reused as they are, if the whole image must be detected
+  bool getMotionGateROIs(const cv::Mat &grey, std::vector<cv::Rect>& rois, std::vector<Marker>& reused);
+  // copies the block means of the frame just detected to the reference of the motion gate, only inside the
+  // regions given (all of them if rois is null), and keeps the markers found for the next frame
+  void updateMotionGate(const std::vector<Marker>& detectedMarkers, const std::vector<cv::Rect>* rois);
+
+  // runs the detection steps (threshold, rectangles, classification, corner refinement) in the grey image passed,
+  // that can be a region of the full image. Points are expressed in the region coordinates. thresholdImageReady
+  // tells that the downsampled image to threshold has already been computed (see convertToGreyAndDecimate)
+  void detectInRegion(const cv::Mat &greyRegion, cv::Size fullImageSize, std::vector<Marker>& detectedMarkers,
+                      bool thresholdImageReady = false);
+  // size of the image in which the rectangles of a region are looked for, downsampled according to the minimum
+  // marker size. It is the size of the region if it is not downsampled
+  cv::Size getThresholdImageSize(cv::Size regionSize, cv::Size fullImageSize) const;
+  // converts a BGR image to grey and builds in the same pass the downsampled grey image, that takes the column
+  // xofs[x] and the row yofs[y] of grey for each pixel (see Workspace::updateDecimationTables). The input is read
+  // once, and each row of grey is decimated while it is still in the cache
+  static void convertToGreyAndDecimate(const cv::Mat &bgr, cv::Mat &grey, cv::Mat &decimated,
+                                       const std::vector<int> &xofs, const std::vector<int> &yofs, ThreadPool &pool);
+
+  // the levels are built lazily, only imagePyramid[0] to imagePyramid[_pyramidLevelsBuilt - 1] are computed
   std::vector<cv::Mat> imagePyramid;
-  void enlargeMarkerCandidate(MarkerCandidate &cand, int fact = 1);
-
-  void cornerUpsample(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize);
-  void cornerUpsample_SUBP(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize);
-
-  void buildPyramid(std::vector<cv::Mat> &imagePyramid, const cv::Mat &grey, int minSize);
-
-  std::vector<aruco::MarkerDetector::MarkerCandidate> thresholdAndDetectRectangles(const cv::Mat & input,
-                                                                                   int thres_param1, int thres_param2,
-                                                                                   bool erode, cv::Mat &auxThresImage);
-  std::vector<aruco::MarkerDetector::MarkerCandidate> thresholdAndDetectRectangles(const cv::Mat &image);
-  std::vector<aruco::MarkerDetector::MarkerCandidate> prefilterCandidates(std::vector<MarkerCandidate> &candidates,
-                                                                          cv::Size orgImageSize);
+  std::size_t _pyramidLevelsBuilt = 0;
+  void enlargeMarkerCandidate(cv::Point2f *cand, int fact = 1);
+
+  void cornerUpsample(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize,
+                      std::chrono::steady_clock::time_point deadline);
+  void cornerUpsample_SUBP(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize,
+                           std::chrono::steady_clock::time_point deadline);
+  // scales the corners of the markers and refines them in image with cornerSubPix, each marker on its own and in
+  // parallel. Markers skipped (_skipCornerRefinement), or not started before the deadline (Params::
+  // cornerRefinementBudgetMs), are only scaled
+  void refineCorners(std::vector<Marker>& markers, const cv::Mat &image, float scale, int halfwsize,
+                     const cv::TermCriteria &criteria, std::chrono::steady_clock::time_point deadline);
+
+  // sets the levels of the pyramid of grey, down to minSize, without building them
+  void resetPyramid(const cv::Mat &grey, int minSize);
+  // computes the levels not built yet up to the one given
+  void buildPyramidLevels(std::size_t level);
+
+  // candidates are stored flat, four consecutive corners per candidate, so that they are moved around without
+  // allocating a vector (and a contour) for each of them
+  typedef std::vector<cv::Point2f> CandidateCorners;
+
+  // thresholded: auxThresImage already holds the thresholded image, only the rectangles are found in it. If erode,
+  // the image is thresholded in unerodedImage and eroded to auxThresImage. Both keep their buffers between frames
+  void thresholdAndDetectRectangles(const cv::Mat & input, int thres_param1, int thres_param2, bool erode,
+                                    bool thresholded, cv::Mat &auxThresImage, cv::Mat &unerodedImage,
+                                    QuadExtractor &quadExtractor, CandidateCorners &MarkerCanditates);
+  // fixedThresholds: THRES_AUTO_FIXED thresholds to try, one image each. If empty, _ThresHold is used with every
+  // window size
+  void thresholdAndDetectRectangles(const cv::Mat &image, CandidateCorners &MarkerCanditates,
+                                    const std::vector<int> &fixedThresholds = std::vector<int>());
+  // computes _thres_Images in the OpenCL device (Params::useOpenCL) for all the window sizes, uploading image once
+  void thresholdInDevice(const cv::Mat &image, bool erode);
+  // removes in place the candidates that are duplicated or too near the image borders
+  void prefilterCandidates(CandidateCorners &candidates, cv::Size orgImageSize);
 
   std::vector<cv::Mat> _thres_Images;
-  std::vector<std::vector<MarkerCandidate> > _vcandidates;
-  std::vector<std::vector<cv::Point2f> > _candidates;
+  // integral image of the image being thresholded (THRES_ADAPTIVE_INTEGRAL)
+  cv::Mat _integralImage;
+  void integralAdaptiveThreshold(const cv::Mat &input, int wsize, int C, cv::Mat &out) const;
+  std::vector<CandidateCorners> _vcandidates;
+  CandidateCorners _candidateCorners;
+  // grid of the candidates by their first corner, used to find the near ones: items of cell c are
+  // _gridItems[_gridCellStart[c]] ... _gridItems[_gridCellStart[c+1]-1]
+  std::vector<int> _gridCellStart, _gridItems, _candidateCell;
+  // one per thresholded image, so that their buffers are reused between frames
+  std::vector<QuadExtractor> _quadExtractors;
+  // rejected candidates, four corners each
+  CandidateCorners _candidates;
+
+  // buffers of the detection reused between frames, defined in markerdetector.cpp
+  struct Workspace;
+  std::unique_ptr<Workspace> _workspace;
 
   // graphical debug
   void drawApproxCurve(cv::Mat& in, std::vector<cv::Point>& approxCurve, cv::Scalar color, int thickness = 1);
   void drawContour(cv::Mat& in, std::vector<cv::Point>& contour, cv::Scalar);
   void drawAllContours(cv::Mat input, std::vector<std::vector<cv::Point>>& contours);
   void draw(cv::Mat out, const std::vector<Marker>& markers);
-
-  enum ThreadTasks
-  {
-    THRESHOLD_TASK, ERODE_TASK, EXIT_TASK
-  };
-  struct ThresAndDetectRectTASK
-  {
-    int inIdx, outIdx;
-    int param1, param2;
-    ThreadTasks task;
-  };
-  void thresholdAndDetectRectangles_thread();
-
-  // thread safe queue to implement producer-consumer
-  template<typename T>
-  class Queue
-  {
-  public:
-    T pop()
-    {
-      std::unique_lock<std::mutex> mlock(mutex_);
-      while (queue_.empty())
-      {
-        cond_.wait(mlock);
-      }
-      auto item = queue_.front();
-      queue_.pop();
-      return item;
-    }
-
-    void push(const T& item)
-    {
-      std::unique_lock<std::mutex> mlock(mutex_);
-      queue_.push(item);
-      mlock.unlock();
-      cond_.notify_one();
-    }
-
-    std::size_t size()
-    {
-      std::unique_lock<std::mutex> mlock(mutex_);
-      std::size_t s = queue_.size();
-      return s;
-    }
-
-  private:
-    std::queue<T> queue_;
-    std::mutex mutex_;
-    std::condition_variable cond_;
-  };
-
-  Queue<ThresAndDetectRectTASK> _tasks;
 };
 
 } // namespace aruco
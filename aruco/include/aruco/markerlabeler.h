@@ -32,6 +32,10 @@
 #include "aruco_export.h"
 #include "dictionary.h"
 #include <opencv2/core.hpp>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace aruco
 {
@@ -40,9 +44,96 @@ namespace aruco
  * \brief Base class of labelers. A labelers receive a square of the image and determines if it has a valid marker,
  * its id and rotation
  * Additionally, it implements the factory model
+ *
+ * Thread safety: detect(), detectFromCells() and detectBatch() of an instance are never called concurrently, so
+ * labelers can keep scratch buffers. To classify the candidates in parallel, the detector gives each extra thread
+ * its own copy created with clone(). Labelers that can not be copied return an empty pointer, and then the
+ * classification is serial.
  */
 class Marker;
 
+/**
+ * \brief Gives access to the cells of a marker candidate without warping it to its canonical image.
+ * The detector passes one to MarkerLabeler::detectFromCells for each candidate.
+ */
+class ARUCO_EXPORT MarkerCellSampler
+{
+public:
+  /**
+   * Divides the candidate in ndiv x ndiv cells (border included) and indicates whether each one is white
+   * @param ndiv number of divisions in each axis
+   * @param cells output, ndiv*ndiv elements in row major order set to 1 (white) or 0 (black)
+   */
+  virtual void getCells(int ndiv, uchar *cells) = 0;
+
+  virtual ~MarkerCellSampler()
+  {
+  }
+};
+
+/**
+ * \brief Ids of the markers wanted from a detection, optionally restricted to a dictionary. An empty filter accepts
+ * every marker. @see MarkerDetector::setMarkerIdFilter
+ */
+class ARUCO_EXPORT MarkerIdFilter
+{
+public:
+  /**
+   * Accepts a marker id
+   * @param id id of the marker
+   * @param dictionary name of the dictionary of the id (Dictionary::getName(), as in Marker::dict_info). If empty,
+   * the id is accepted in any dictionary
+   */
+  void add(int id, const std::string &dictionary = "")
+  {
+    auto entry = std::make_pair(dictionary, id);
+    if (std::find(_ids.begin(), _ids.end(), entry) == _ids.end())
+      _ids.push_back(entry);
+  }
+
+  void clear()
+  {
+    _ids.clear();
+  }
+
+  bool empty() const
+  {
+    return _ids.empty();
+  }
+
+  // number of ids accepted
+  std::size_t size() const
+  {
+    return _ids.size();
+  }
+
+  // index, in the order they were added, of the id that accepts the marker. -1 if it is not accepted
+  int index(int id, const std::string &dictionary) const
+  {
+    for (std::size_t i = 0; i < _ids.size(); i++)
+      if (_ids[i].second == id && (_ids[i].first.empty() || _ids[i].first == dictionary))
+        return static_cast<int>(i);
+    return -1;
+  }
+
+  bool accepts(int id, const std::string &dictionary) const
+  {
+    return empty() || index(id, dictionary) != -1;
+  }
+
+  // false if no id of the dictionary is accepted, so that it need not be searched
+  bool acceptsDictionary(const std::string &dictionary) const
+  {
+    for (const auto &entry : _ids)
+      if (entry.first.empty() || entry.first == dictionary)
+        return true;
+    return empty();
+  }
+
+private:
+  std::vector<std::pair<std::string, int>> _ids; // dictionary (empty for any) and id
+};
+
 class ARUCO_EXPORT MarkerLabeler
 {
 public:
@@ -81,6 +172,65 @@ public:
    */
   virtual bool detect(const cv::Mat& in, int& marker_id, int& nRotations, std::string &additionalInfo) = 0;
 
+  /**
+   * Fast version of detect() for labelers that only need to know the color of the cells of the marker. The sampler
+   * reads them from the image directly, without creating the canonical image of the candidate.
+   * Only called if supportsCellSampling() returns true.
+   */
+  virtual bool detectFromCells(MarkerCellSampler& sampler, int& marker_id, int& nRotations,
+                               std::string &additionalInfo)
+  {
+    (void)sampler;
+    (void)marker_id;
+    (void)nRotations;
+    (void)additionalInfo;
+    return false;
+  }
+
+  // indicates if detectFromCells() can be employed
+  virtual bool supportsCellSampling() const
+  {
+    return false;
+  }
+
+  // result of detect() for one candidate
+  struct Label
+  {
+    bool isMarker = false;
+    int id = -1, nRotations = 0;
+    std::string additionalInfo;
+  };
+
+  /**
+   * Identifies the markers in the canonical images of all the candidates of a frame at once, for labelers whose
+   * cost is mostly per call (e.g. a classifier that predicts many samples at once). By default calls detect() on
+   * each image. The detector calls it instead of detect(), from one thread, if supportsBatchDetection() is true
+   * @param in canonical images, as passed to detect()
+   * @param labels output, one per image
+   */
+  virtual void detectBatch(const std::vector<cv::Mat>& in, std::vector<Label>& labels)
+  {
+    labels.resize(in.size());
+    for (std::size_t i = 0; i < in.size(); i++)
+      labels[i].isMarker = detect(in[i], labels[i].id, labels[i].nRotations, labels[i].additionalInfo);
+  }
+
+  // indicates if detectBatch() should be employed instead of detect(). Cell sampling takes precedence over it
+  virtual bool supportsBatchDetection() const
+  {
+    return false;
+  }
+
+  /**
+   * Restricts the markers returned to the ids of the filter, so that the labeler can discard the rest as soon as
+   * their codes are read and not look for them in dictionaries without accepted ids. Labelers that do not
+   * implement it return every marker, and the detector discards them
+   */
+  virtual void setIdFilter(const MarkerIdFilter& filter)
+  {
+    (void)filter;
+  }
+
   /**
    * @brief getBestInputSize if desired, you can set the desired input size to the detect function
    * @return -1 if detect accept any type of input, or a size otherwise
@@ -103,6 +253,15 @@ public:
   // returns a string that describes the labeler and can be used to create it
   virtual std::string getName() const = 0;
 
+  /**
+   * Returns an independent copy of the labeler with the same configuration, to be used from another thread.
+   * By default, labelers can not be cloned and an empty pointer is returned
+   */
+  virtual cv::Ptr<MarkerLabeler> clone() const
+  {
+    return cv::Ptr<MarkerLabeler>();
+  }
+
   virtual ~MarkerLabeler()
   {
   }
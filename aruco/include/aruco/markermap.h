@@ -34,7 +34,10 @@
 
 #include <opencv2/core.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace aruco
@@ -169,6 +172,12 @@ public:
    */
   const Marker3DInfo& getMarker3DInfo(int id) const;
 
+  /**
+   * Returns the Info of the marker with id specified, or nullptr if not in the set. It takes constant time for the
+   * ids in the index, and linear time for the rest (@see buildIndex).
+   */
+  const Marker3DInfo* findMarker3DInfo(int id) const;
+
   /**
    * Returns the index of the marker (in this object) with id indicated, if is in the vector
    */
@@ -185,6 +194,22 @@ public:
    */
   cv::Mat getImage(float METER2PIX = 0) const;
 
+  /**
+   * Returns this map expressed in meters. If it is in pixels, the conversion (@see convertToMeters) is made only the
+   * first time for the markerSize given, and the result is kept for the following calls. A checksum of the ids and
+   * points of the elements tells if they have been edited since, and then the conversion is made again.
+   */
+  const MarkerMap& getMetricMap(float markerSize);
+
+  /**
+   * Rebuilds the index of the ids used by the lookups (@see findMarker3DInfo) and discards the metric map cached.
+   * The index is built when the map is read. The lookups do not trust it blindly: the element found must have the
+   * id looked for, and the ids not found in it (or all of them, if the number of elements has changed) are looked
+   * for with a linear search. So after editing the elements by hand the lookups are still right, but slower until
+   * this is called.
+   */
+  void buildIndex();
+
   /**
    * Saves the board info to a file
    */
@@ -195,7 +220,8 @@ public:
    */
   void readFromFile(std::string sfile);
 
-  // calculates the camera location w.r.t. the map using the information provided. Returns the <rvec, tvec>
+  // calculates the camera location w.r.t. the map using the information provided. Returns the <rvec, tvec>.
+  // Maps in pixels are converted with getMetricMap, so elements edited by hand are taken into account
   std::pair<cv::Mat, cv::Mat> calculateExtrinsics(const std::vector<aruco::Marker>& markers, float markerSize,
                                                   cv::Mat CameraMatrix, cv::Mat Distorsion);
 
@@ -225,6 +251,17 @@ private:
   // dictionary it belongs to (if any)
   std::string dictionary;
 
+  // index of each marker id in the vector, for the size of the vector given
+  std::unordered_map<int, int> _idIndex;
+  std::size_t _indexedSize = 0;
+
+  // this map in meters, and the marker size used to convert it
+  std::shared_ptr<const MarkerMap> _metricMap;
+  float _metricMarkerSize = 0;
+  uint64_t _metricChecksum = 0; // of the elements converted
+  // hash of the ids and the points of the elements, computed without allocating
+  uint64_t checksum() const;
+
 private:
   /**
    * Saves the board info to a file
@@ -33,7 +33,9 @@
 #include "cameraparameters.h"
 #include "marker.h"
 #include "markermap.h"
+#include "threadpool.h"
 
+#include <cstdint>
 #include <map>
 #include <opencv2/core.hpp>
 
@@ -82,6 +84,13 @@ public:
   bool estimatePose(Marker& m, const CameraParameters& cam_params, float markerSize,
                     float minErrorRatio = 4 /* tau_e in paper */);
 
+  /**
+   * As above, with a camera prepared for the image size. The matrices of the camera are used without converting them
+   * @param camera camera parameters prepared for the size of the image where the marker was detected
+   */
+  bool estimatePose(Marker& m, const PreparedCamera& camera, float markerSize,
+                    float minErrorRatio = 4 /* tau_e in paper */);
+
   // returns the 4x4 transform matrix. Returns an empty matrix if last call to estimatePose returned false
   cv::Mat getRTMatrix() const;
 
@@ -97,8 +106,22 @@ public:
     return _tvec;
   }
 
+  // indicates if there is a pose to start from, so that the next call to estimatePose only refines it
+  bool isTracking() const
+  {
+    return !_rvec.empty();
+  }
+
+  // forgets the current pose, so that the next call to estimatePose initializes it again
+  void reset()
+  {
+    _rvec = cv::Mat();
+    _tvec = cv::Mat();
+  }
+
 private:
   cv::Mat _rvec, _tvec; // current poses
+  PreparedCamera _camera; // last camera parameters passed, only prepared again when they change
   double solve_pnp(const std::vector<cv::Point3f>& p3d, const std::vector<cv::Point2f>& p2d, const cv::Mat& cam_matrix,
                    const cv::Mat& dist, cv::Mat& r_io, cv::Mat& t_io);
 };
@@ -135,6 +158,26 @@ public:
   // estimates camera pose wrt the markermap. Returns true if pose has been obtained and false otherwise
   bool estimatePose(const std::vector<Marker>& v_m);
 
+  /**
+   * @brief setThreadPool runs the relocalization in the workers of the pool passed (e.g. the one of the detector).
+   * By default, it runs in the calling thread
+   */
+  void setThreadPool(cv::Ptr<ThreadPool> pool)
+  {
+    _threadPool = pool;
+  }
+
+  /**
+   * @brief setRelocalizationSubset sets the maximum number of markers whose points are used to score the pose
+   * hypotheses of the relocalization. When more markers of the map are visible, the hypotheses are scored with a
+   * subset of them spread over the list, so that the relocalization grows linearly with the number of markers
+   * instead of quadratically. The best pose is refined with all the points anyway. Use -1 to score with all of them
+   */
+  void setRelocalizationSubset(int maxMarkers)
+  {
+    _relocalizationSubset = maxMarkers;
+  }
+
   // returns the 4x4 transform matrix. Returns an empty matrix if last call to estimatePose returned false
   cv::Mat getRTMatrix() const;
 
@@ -153,14 +196,80 @@ public:
 private:
   cv::Mat _rvec, _tvec; // current poses
   aruco::CameraParameters _cam_params;
+  PreparedCamera _camera; // _cam_params prepared for their image size
   MarkerMap _msconf;
   std::map<int, Marker3DInfo> _map_mm;
   bool _isValid;
   cv::Mat relocalization(const std::vector<Marker>& v_m);
   float aruco_minerrratio_valid; /* tau_e in paper */
+  cv::Ptr<ThreadPool> _threadPool;
+  int _relocalizationSubset;
   std::map<uint32_t, cv::Mat> marker_m2g; // for each marker, the transform from the global ref system to the marker ref system
 };
 
+/**
+ * Tracks the poses of all the markers seen, keeping a MarkerPoseTracker per id. The pose of a marker tracked is
+ * refined from the one of the previous frame with a few LevMarq iterations, instead of being solved from scratch.
+ *
+ * A marker starts to be tracked when its IPPE solution is not ambiguous (see MarkerPoseTracker). Until then, its pose
+ * is the best IPPE solution. A track is started again when its pose no longer explains the corners (the mean
+ * reprojection error is above maxReprojError pixels), and it is forgotten when its marker has not been seen for
+ * maxAge frames.
+ */
+class ARUCO_EXPORT MultiMarkerPoseTracker
+{
+public:
+  MultiMarkerPoseTracker(int maxAge = 10, float minErrorRatio = 4 /* tau_e in paper */, float maxReprojError = 2);
+
+  /**
+   * Estimates the poses (Rvec, Tvec) of the markers detected in a new frame. The poses have the Z axis perpendicular
+   * to the marker plane
+   * @param markers markers detected in the frame
+   * @param camera camera parameters prepared for the size of the image
+   * @param markerSize size of the marker side expressed in meters
+   */
+  void estimatePoses(std::vector<Marker>& markers, const PreparedCamera& camera, float markerSize);
+
+  /**
+   * As above, preparing the camera parameters for the image size. Nothing is done if they are not valid or
+   * markerSize <= 0
+   */
+  void estimatePoses(std::vector<Marker>& markers, const CameraParameters& cam_params, cv::Size imageSize,
+                     float markerSize);
+
+  // forgets all the tracks
+  void reset()
+  {
+    _tracks.clear();
+  }
+
+  // number of markers tracked
+  std::size_t size() const
+  {
+    return _tracks.size();
+  }
+
+  // indicates if the pose of the marker with the id passed was refined from the previous one in the last frame
+  bool isTracked(int id) const;
+
+private:
+  struct Track
+  {
+    MarkerPoseTracker tracker;
+    uint64_t lastFrame = 0; // last frame the marker was seen
+    bool refined = false; // the pose was refined in lastFrame
+  };
+
+  // mean distance in pixels between the corners and the projection of the pose of the marker
+  static double reprojectionError(const Marker& m, const PreparedCamera& camera, float markerSize);
+
+  std::map<int, Track> _tracks;
+  uint64_t _frame;
+  int _maxAge;
+  float _minErrorRatio, _maxReprojError;
+  PreparedCamera _camera; // camera parameters passed to estimatePoses, only prepared again when they change
+};
+
 } // namespace aruco
 
 #endif /* ARUCO_POSETRACKER */
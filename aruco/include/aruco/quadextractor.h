@@ -0,0 +1,72 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+
+#ifndef _ARUCO_QuadExtractor_H
+#define _ARUCO_QuadExtractor_H
+
+#include "aruco_export.h"
+#include <opencv2/core.hpp>
+#include <vector>
+
+namespace aruco
+{
+
+/**
+ * \brief Extracts the convex quadrilaterals formed by the borders of the regions of a binary image.
+ *
+ * It is a replacement of findContours(RETR_LIST, CHAIN_APPROX_NONE) + approxPolyDP + isContourConvex in which the
+ * borders are followed directly (Suzuki & Abe, 1985) into an internal buffer that is reused for all of them, so
+ * that short contours are discarded without allocating memory. All buffers are kept between calls, i.e., once warmed
+ * up, no allocations are done for images of the same size.
+ * An object must not be used by several threads at the same time.
+ */
+class ARUCO_EXPORT QuadExtractor
+{
+public:
+  /**
+   * @param binary thresholded image (CV_8UC1). Non zero pixels are the foreground
+   * @param minContourPoints contours with this number of points or less are discarded before any fitting
+   * @param approxFactor accuracy of the polygonal approximation, relative to the contour length
+   * @return the corners of the quads found, four consecutive points per quad. The buffer belongs to this object and
+   * is overwritten in the next call
+   */
+  const std::vector<cv::Point> &extract(const cv::Mat &binary, int minContourPoints, double approxFactor = 0.05);
+
+private:
+  // follows the border starting at pixel (x,y) of _labels. startDir is the direction of its background neighbour
+  void followBorder(int x, int y, int startDir);
+  void fitQuad(double approxFactor);
+
+  // padded copy of the image. 0: background, 1: foreground not yet visited, 2 and -2: border already followed
+  cv::Mat _labels;
+  std::vector<cv::Point> _contour, _approx, _quads;
+};
+
+} // namespace aruco
+
+#endif /* _ARUCO_QuadExtractor_H */
@@ -0,0 +1,116 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+
+#ifndef _ARUCO_ThreadPool_H
+#define _ARUCO_ThreadPool_H
+
+#include "aruco_export.h"
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace aruco
+{
+
+/**
+ * \brief Set of long-lived worker threads used to run the parallel stages of the detector.
+ *
+ * Threads are created once and reused for every frame, so that no thread is created or joined in the
+ * hot path. A pool may be shared by several detectors (see MarkerDetector::setThreadPool).
+ * All the methods are thread safe.
+ */
+class ARUCO_EXPORT ThreadPool
+{
+public:
+  /**
+   * Creates the pool with the indicated number of worker threads.
+   * @param nthreads number of workers. 0 means no workers, i.e., all the work is done by the calling thread.
+   * A negative value means std::thread::hardware_concurrency()-1 workers.
+   */
+  ThreadPool(int nthreads = 0);
+
+  /**
+   * Stops the workers. See @see shutdown
+   */
+  ~ThreadPool();
+
+  /**
+   * Changes the number of workers. Pending jobs are finished before the old workers are released.
+   */
+  void resize(int nthreads);
+
+  /**
+   * Number of worker threads
+   */
+  int size() const;
+
+  /**
+   * Waits for the queued jobs to finish and joins all the workers. Afterwards, the pool behaves as a pool
+   * of size 0 until resize() is called.
+   */
+  void shutdown();
+
+  /**
+   * Executes func(0), func(1) ... func(n-1) in parallel and waits until all of them have finished.
+   * The calling thread takes part in the work, so it is safe to call this from inside a job.
+   * If any of the calls throws, the first exception is rethrown here once the rest have finished.
+   */
+  void run(std::size_t n, const std::function<void(std::size_t)>& func);
+
+  /**
+   * Queues func to be executed by a worker. If the pool has no workers, func is executed right away.
+   * @return future to wait for the completion of the job. Exceptions are transported through it.
+   */
+  std::future<void> async(const std::function<void()>& func);
+
+  /**
+   * Returns the number of workers that will be useful for a given Params::maxThreads value, having in mind
+   * that the calling thread works too.
+   */
+  static int workersFor(int maxThreads);
+
+private:
+  void workerLoop();
+  bool push(const std::function<void()>& job);
+  void stop();
+
+  std::vector<std::thread> _workers;
+  std::queue<std::function<void()>> _jobs;
+  mutable std::mutex _mutex;
+  std::condition_variable _cond;
+  bool _stopping = false;
+};
+
+} // namespace aruco
+
+#endif /* _ARUCO_ThreadPool_H */
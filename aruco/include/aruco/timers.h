@@ -29,7 +29,11 @@
 #ifndef ARUCO_TIMERS_H
 #define ARUCO_TIMERS_H
 
+#include "aruco_export.h"
+
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -37,6 +41,63 @@
 namespace aruco
 {
 
+/**
+ * While an instance is alive, the events of the ScopedTimerEvents created in the same thread are recorded in it, even
+ * if USE_TIMERS is not defined. It is the way to measure the stages of the detector from a program (e.g. aruco_bench).
+ * Instances can be nested, the events go to the innermost one. It must outlive the ScopedTimerEvents it records.
+ * The jobs that ThreadPool::run gives to the workers record in the recorder of the thread that called it, so the
+ * events of the parallel stages are there too, one per job: their times add up the work of all the threads.
+ */
+struct ARUCO_EXPORT TimerEventsRecorder
+{
+  struct Event
+  {
+    std::string name; // name of the ScopedTimerEvents and of the event, separated by '|'
+    double ms; // time since the previous event
+  };
+  // read it once the recorded work has finished
+  std::vector<Event> events;
+
+  TimerEventsRecorder();
+  ~TimerEventsRecorder();
+
+  // appends an event, from any thread
+  void add(Event event);
+
+  // recorder of the calling thread, nullptr if none
+  static TimerEventsRecorder* current();
+
+  // true if a recorder is alive in any thread. Checked inline first, so that timers cost nothing when not recorded
+  static bool anyRecording()
+  {
+    return _alive.load(std::memory_order_relaxed) != 0;
+  }
+
+  /**
+   * Makes the calling thread record in the recorder given (it may be nullptr) while the instance is alive. Used by
+   * the workers of ThreadPool, so that their events go to the recorder of the thread the work comes from
+   */
+  struct ARUCO_EXPORT Adopt
+  {
+    Adopt(TimerEventsRecorder *recorder);
+    ~Adopt();
+
+  private:
+    Adopt(const Adopt&);
+    Adopt& operator=(const Adopt&);
+
+    TimerEventsRecorder* _previous;
+  };
+
+private:
+  TimerEventsRecorder(const TimerEventsRecorder&);
+  TimerEventsRecorder& operator=(const TimerEventsRecorder&);
+
+  TimerEventsRecorder* _previous;
+  std::mutex _mutex;
+  static std::atomic<int> _alive;
+};
+
 //timer
 struct ScopeTimer
 {
@@ -111,33 +172,34 @@ struct ScopedTimerEvents
   std::vector<std::chrono::high_resolution_clock::time_point> vtimes;
   std::vector<std::string> names;
   std::string _name;
+  TimerEventsRecorder *_recorder;
 
-  ScopedTimerEvents(std::string name = "", bool start = true, SCALE _sc = MSEC)
+  ScopedTimerEvents(std::string name = "", bool start = true, SCALE _sc = MSEC) :
+      sc(_sc), _recorder(TimerEventsRecorder::anyRecording() ? TimerEventsRecorder::current() : nullptr)
   {
-
-#ifdef USE_TIMERS
+    if (!enabled())
+      return;
+    _name = name;
     if (start)
       add("start");
-    sc = _sc;
-    _name = name;
+  }
+
+  // the events are only taken if they are going to be printed or recorded
+  bool enabled() const
+  {
+#ifdef USE_TIMERS
+    return true;
 #else
-    (void)name;
-    (void)start;
-    (void)_sc;
+    return _recorder != nullptr;
 #endif /* USE_TIMERS */
-
   }
 
   void add(std::string name)
   {
-
-#ifdef USE_TIMERS
+    if (!enabled())
+      return;
     vtimes.push_back(std::chrono::high_resolution_clock::now());
     names.push_back(name);
-#else
-    (void)name;
-#endif /* USE_TIMERS */
-
   }
 
   void addspaces(std::vector<std::string> &str)
@@ -155,6 +217,19 @@ struct ScopedTimerEvents
 
   ~ScopedTimerEvents()
   {
+    if (!enabled())
+      return;
+    add("total");
+    if (_recorder)
+    {
+      // the total is measured since the start, the rest of events since the previous one
+      for (size_t i = 1; i < vtimes.size(); i++)
+      {
+        auto from = i + 1 < vtimes.size() ? vtimes[i - 1] : vtimes[0];
+        double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(vtimes[i] - from).count());
+        _recorder->add(TimerEventsRecorder::Event {_name + "|" + names[i], ns / 1e6});
+      }
+    }
 
 #ifdef USE_TIMERS
     double fact = 1;
@@ -175,7 +250,6 @@ struct ScopedTimerEvents
         break;
     };
 
-    add("total");
     addspaces(names);
     for (size_t i = 1; i < vtimes.size(); i++)
     {
@@ -0,0 +1,325 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+
+#include "batchdetector.h"
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/videoio.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace aruco
+{
+
+namespace
+{
+
+// images of a folder, by name. Files that are not images are skipped
+class ImageFolderSource : public FrameSource
+{
+public:
+  explicit ImageFolderSource(std::vector<cv::String> files) :
+      _files(std::move(files)), _next(0)
+  {
+  }
+
+  bool read(cv::Mat& frame, std::string& name)
+  {
+    for (; _next < _files.size(); _next++)
+    {
+      frame = cv::imread(_files[_next]);
+      if (frame.empty())
+        continue;
+      const std::string& path = _files[_next++];
+      std::size_t sep = path.find_last_of("/\\");
+      name = sep == std::string::npos ? path : path.substr(sep + 1);
+      return true;
+    }
+    return false;
+  }
+
+private:
+  std::vector<cv::String> _files;
+  std::size_t _next;
+};
+
+// frames of a video, named by their position in it
+class VideoSource : public FrameSource
+{
+public:
+  explicit VideoSource(const std::string& path) :
+      _next(0)
+  {
+    if (!_capture.open(path))
+      throw cv::Exception(9001, "Unable to open " + path, "FrameSource::open", __FILE__, __LINE__);
+  }
+
+  bool read(cv::Mat& frame, std::string& name)
+  {
+    if (!_capture.read(frame) || frame.empty())
+      return false;
+    name = std::to_string(_next++);
+    return true;
+  }
+
+private:
+  cv::VideoCapture _capture;
+  uint64_t _next;
+};
+
+}
+
+cv::Ptr<FrameSource> FrameSource::open(const std::string& path)
+{
+  // cv::glob can only list the files of a folder, it throws for anything else
+  std::vector<cv::String> files;
+  try
+  {
+    cv::glob(path + "/*", files, false);
+  }
+  catch (const cv::Exception&)
+  {
+    return cv::makePtr<VideoSource>(path);
+  }
+  return cv::makePtr<ImageFolderSource>(files);
+}
+
+BatchDetector::BatchDetector(const std::function<void(MarkerDetector&)>& configure, int workers,
+                             std::size_t maxFramesInFlight) :
+    _configure(configure), _workers(workers), _maxFramesInFlight(maxFramesInFlight)
+{
+  if (_workers <= 0)
+    _workers = std::max(1u, std::thread::hardware_concurrency());
+  if (_maxFramesInFlight == 0)
+    _maxFramesInFlight = 2 * std::size_t(_workers);
+}
+
+void BatchDetector::setCameraParameters(const CameraParameters& camera, float markerSize)
+{
+  _camera = camera;
+  _markerSize = markerSize;
+}
+
+cv::Ptr<MarkerDetector> BatchDetector::createDetector() const
+{
+  cv::Ptr<MarkerDetector> detector = cv::makePtr<MarkerDetector>();
+  detector->getParameters().maxThreads = 1;
+  if (_configure)
+    _configure(*detector);
+  return detector;
+}
+
+void BatchDetector::detect(MarkerDetector& detector, const cv::Mat& frame, Result& result) const
+{
+  result.imageSize = frame.size();
+  if (_camera.isValid() && _markerSize > 0)
+    detector.detect(frame, result.markers, _camera, _markerSize);
+  else
+    detector.detect(frame, result.markers);
+}
+
+uint64_t BatchDetector::run(const std::vector<cv::Ptr<FrameSource>>& sources,
+                            const std::function<void(const Result&)>& sink)
+{
+  DetectionMode mode = createDetector()->getDetectionMode();
+  if (mode == DM_VIDEO_FAST || mode == DM_TRACKING)
+    return runSequences(sources, sink);
+  return runFrames(sources, sink);
+}
+
+uint64_t BatchDetector::runSequences(const std::vector<cv::Ptr<FrameSource>>& sources,
+                                     const std::function<void(const Result&)>& sink)
+{
+  // each worker takes the next sequence not started, and processes it with a new detector
+  std::atomic<std::size_t> nextSequence(0);
+  std::atomic<bool> stop(false);
+  std::mutex mutex; // of the sink and the fields below
+  std::exception_ptr error;
+  uint64_t nframes = 0;
+
+  auto work = [&]()
+  {
+    try
+    {
+      std::size_t s;
+      while (!stop && (s = nextSequence++) < sources.size())
+      {
+        cv::Ptr<MarkerDetector> detector = createDetector();
+        Result result;
+        result.sequence = s;
+        cv::Mat frame;
+        for (uint64_t f = 0; !stop && sources[s]->read(frame, result.name); f++)
+        {
+          result.frame = f;
+          detect(*detector, frame, result);
+          std::lock_guard<std::mutex> lock(mutex);
+          sink(result);
+          nframes++;
+        }
+      }
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!error)
+        error = std::current_exception();
+      stop = true;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 1; t < std::min(std::size_t(_workers), sources.size()); t++)
+    threads.emplace_back(work);
+  work();
+  for (auto& thread : threads)
+    thread.join();
+  if (error)
+    std::rethrow_exception(error);
+  return nframes;
+}
+
+uint64_t BatchDetector::runFrames(const std::vector<cv::Ptr<FrameSource>>& sources,
+                                  const std::function<void(const Result&)>& sink)
+{
+  // the frames are numbered in the order they are read, and passed to the sink in that order. The worker that
+  // finishes the next frame to pass calls the sink, for it and for the following ones already finished
+  struct Job
+  {
+    uint64_t index;
+    Result result;
+    cv::Mat frame;
+  };
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::deque<Job> jobs; // read and not taken by a worker
+  std::map<uint64_t, Result> finished; // detected and not passed to the sink
+  uint64_t nread = 0, npassed = 0;
+  bool endOfInput = false, stop = false, passing = false;
+  std::exception_ptr error;
+
+  auto fail = [&]()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!error)
+      error = std::current_exception();
+    stop = true;
+    cond.notify_all();
+  };
+
+  auto work = [&]()
+  {
+    try
+    {
+      cv::Ptr<MarkerDetector> detector = createDetector();
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true)
+      {
+        cond.wait(lock, [&]
+        { return !jobs.empty() || endOfInput || stop;});
+        if (stop || jobs.empty())
+          return;
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        lock.unlock();
+
+        detect(*detector, job.frame, job.result);
+        job.frame.release();
+
+        lock.lock();
+        finished.emplace(job.index, std::move(job.result));
+        if (passing)
+          continue;
+        passing = true;
+        while (!stop && !finished.empty() && finished.begin()->first == npassed)
+        {
+          Result result = std::move(finished.begin()->second);
+          finished.erase(finished.begin());
+          lock.unlock();
+          sink(result);
+          lock.lock();
+          npassed++;
+          cond.notify_all();
+        }
+        passing = false;
+      }
+    }
+    catch (...)
+    {
+      fail();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < _workers; t++)
+    threads.emplace_back(work);
+
+  // the calling thread reads the frames, waiting while there are too many in memory
+  try
+  {
+    bool stopped = false;
+    for (std::size_t s = 0; s < sources.size() && !stopped; s++)
+    {
+      Job job;
+      job.result.sequence = s;
+      for (uint64_t f = 0; sources[s]->read(job.frame, job.result.name); f++)
+      {
+        job.result.frame = f;
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]
+        { return nread - npassed < _maxFramesInFlight || stop;});
+        if ((stopped = stop))
+          break;
+        job.index = nread++;
+        jobs.push_back(job);
+        cond.notify_all();
+        job.frame = cv::Mat(); // the next frame is read in a new buffer
+      }
+    }
+  }
+  catch (...)
+  {
+    fail();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    endOfInput = true;
+    cond.notify_all();
+  }
+  for (auto& thread : threads)
+    thread.join();
+  if (error)
+    std::rethrow_exception(error);
+  return npassed;
+}
+
+} // namespace aruco
@@ -30,7 +30,9 @@
 
 #include <opencv2/calib3d.hpp>
 #include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -557,4 +559,179 @@ std::istream &operator>>(std::istream &str, CameraParameters&cp)
   return str;
 }
 
+// value i (in row-major order) of a float or double matrix, so that vectors in rows or columns are read the same way
+static double matValue(const cv::Mat& m, int i)
+{
+  int r = i / m.cols, c = i % m.cols;
+  return m.depth() == CV_64F ? m.at<double>(r, c) : static_cast<double>(m.at<float>(r, c));
+}
+
+PreparedCamera::PreparedCamera() :
+    Offset(0, 0, 0), _K(cv::Matx33d::zeros()), _T(0, 0, 0), _hasDistortion(false)
+{
+}
+
+/**
+ */
+bool PreparedCamera::prepare(const CameraParameters& CP, cv::Size imageSize)
+{
+  if (!CP.isValid())
+    throw cv::Exception(9007, "invalid camera parameters", "PreparedCamera::prepare", __FILE__, __LINE__);
+
+  cv::Matx33d K;
+  for (int i = 0; i < 9; i++)
+    K.val[i] = matValue(CP.CameraMatrix, i);
+  if (imageSize != CP.CamSize)
+  {
+    // same adjustment as CameraParameters::resize
+    float AxFactor = float(imageSize.width) / float(CP.CamSize.width);
+    float AyFactor = float(imageSize.height) / float(CP.CamSize.height);
+    K(0, 0) = static_cast<float>(K(0, 0)) * AxFactor;
+    K(0, 2) = static_cast<float>(K(0, 2)) * AxFactor;
+    K(1, 1) = static_cast<float>(K(1, 1)) * AyFactor;
+    K(1, 2) = static_cast<float>(K(1, 2)) * AyFactor;
+  }
+
+  double D[14];
+  int nD = std::min(static_cast<int>(CP.Distorsion.total()), 14);
+  for (int i = 0; i < nD; i++)
+    D[i] = matValue(CP.Distorsion, i);
+
+  cv::Vec3d T(0, 0, 0);
+  if (CP.ExtrinsicMatrix.total() == 3)
+    for (int i = 0; i < 3; i++)
+      T[i] = matValue(CP.ExtrinsicMatrix, i);
+
+  return set(K, D, nD, T, imageSize);
+}
+
+/**
+ */
+bool PreparedCamera::prepare(const cv::Mat& cameraMatrix, const cv::Mat& distorsionCoeff, const cv::Mat& extrinsics,
+                             cv::Size imageSize)
+{
+  if (cameraMatrix.rows != 3 || cameraMatrix.cols != 3
+      || (cameraMatrix.depth() != CV_32F && cameraMatrix.depth() != CV_64F))
+    throw cv::Exception(9000, "invalid input cameraMatrix", "PreparedCamera::prepare", __FILE__, __LINE__);
+  if (distorsionCoeff.total() > 14)
+    throw cv::Exception(9000, "invalid input distorsionCoeff", "PreparedCamera::prepare", __FILE__, __LINE__);
+
+  cv::Matx33d K;
+  for (int i = 0; i < 9; i++)
+    K.val[i] = matValue(cameraMatrix, i);
+
+  double D[14];
+  int nD = static_cast<int>(distorsionCoeff.total());
+  for (int i = 0; i < nD; i++)
+    D[i] = matValue(distorsionCoeff, i);
+
+  cv::Vec3d T(0, 0, 0);
+  if (extrinsics.total() == 3)
+    for (int i = 0; i < 3; i++)
+      T[i] = matValue(extrinsics, i);
+
+  return set(K, D, nD, T, imageSize);
+}
+
+bool PreparedCamera::set(const cv::Matx33d& K, const double* D, int nD, const cv::Vec3d& T, cv::Size imageSize)
+{
+  // no distortion is kept as four zeros, so that preparing again from Distorsion64 is not a change
+  static const double noDistortion[4] = {0, 0, 0, 0};
+  if (nD == 0)
+  {
+    D = noDistortion;
+    nD = 4;
+  }
+  bool changed = imageSize != CamSize || K != _K || T != _T || nD != static_cast<int>(_D.size());
+  for (int i = 0; i < nD && !changed; i++)
+    changed = D[i] != _D[i];
+  if (!changed)
+    return false;
+
+  _K = K;
+  _D.assign(D, D + nD);
+  _T = T;
+  CamSize = imageSize;
+
+  cv::Mat(K).copyTo(CameraMatrix64);
+  CameraMatrix64.convertTo(CameraMatrix, CV_32F);
+  cv::Mat(_D).reshape(1, 1).copyTo(Distorsion64);
+  Distorsion64.convertTo(Distorsion, CV_32F);
+  cv::Mat(T).reshape(1, 1).copyTo(ExtrinsicMatrix);
+
+  // as done by Marker::calculateExtrinsics with the extrinsics of stereo cameras
+  Offset.x = -1 * static_cast<float>(T[0] / CameraMatrix.at<float>(0, 0));
+  Offset.y = -1 * static_cast<float>(T[1] / CameraMatrix.at<float>(1, 1));
+  Offset.z = -1 * static_cast<float>(T[2] / CameraMatrix.at<float>(2, 2));
+
+  _hasDistortion = cv::countNonZero(Distorsion64) != 0;
+  buildUndistortionTable();
+  return true;
+}
+
+void PreparedCamera::buildUndistortionTable()
+{
+  if (!_hasDistortion)
+  {
+    _undistortionTable.release();
+    return;
+  }
+
+  // the nodes cover the whole image, the last ones may lie beyond its border
+  int cols = (CamSize.width - 1) / TableStep + 2, rows = (CamSize.height - 1) / TableStep + 2;
+  std::vector<cv::Point2f> nodes;
+  nodes.reserve(rows * cols);
+  for (int y = 0; y < rows; y++)
+    for (int x = 0; x < cols; x++)
+      nodes.push_back(cv::Point2f(static_cast<float>(x * TableStep), static_cast<float>(y * TableStep)));
+  std::vector<cv::Point2f> normalized;
+  cv::undistortPoints(nodes, normalized, CameraMatrix64, Distorsion64);
+  cv::Mat(normalized).reshape(2, rows).copyTo(_undistortionTable);
+}
+
+/**
+ */
+void PreparedCamera::undistortPoints(const std::vector<cv::Point2f>& points,
+                                     std::vector<cv::Point2f>& normalized) const
+{
+  if (!isValid())
+    throw cv::Exception(9007, "the camera has not been prepared", "PreparedCamera::undistortPoints", __FILE__,
+                        __LINE__);
+  normalized.resize(points.size());
+
+  if (!_hasDistortion)
+  {
+    // inverse of the camera matrix
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+      double y = (points[i].y - _K(1, 2)) / _K(1, 1);
+      double x = (points[i].x - _K(0, 2) - _K(0, 1) * y) / _K(0, 0);
+      normalized[i] = cv::Point2f(static_cast<float>(x), static_cast<float>(y));
+    }
+    return;
+  }
+
+  // bilinear interpolation in the table
+  float maxX = static_cast<float>((_undistortionTable.cols - 1) * TableStep);
+  float maxY = static_cast<float>((_undistortionTable.rows - 1) * TableStep);
+  for (std::size_t i = 0; i < points.size(); i++)
+  {
+    const cv::Point2f &p = points[i];
+    if (!(p.x >= 0 && p.y >= 0 && p.x < maxX && p.y < maxY))
+    {
+      std::vector<cv::Point2f> in(1, p), out;
+      cv::undistortPoints(in, out, CameraMatrix64, Distorsion64);
+      normalized[i] = out[0];
+      continue;
+    }
+    float fx = p.x / TableStep, fy = p.y / TableStep;
+    int x0 = static_cast<int>(fx), y0 = static_cast<int>(fy);
+    float ax = fx - x0, ay = fy - y0;
+    const cv::Vec2f *row0 = _undistortionTable.ptr<cv::Vec2f>(y0) + x0;
+    const cv::Vec2f *row1 = _undistortionTable.ptr<cv::Vec2f>(y0 + 1) + x0;
+    cv::Vec2f v = (row0[0] * (1 - ax) + row0[1] * ax) * (1 - ay) + (row1[0] * (1 - ax) + row1[1] * ax) * ay;
+    normalized[i] = cv::Point2f(v[0], v[1]);
+  }
+}
+
 } // namespace aruco
@@ -116,6 +116,20 @@ std::vector<std::pair<cv::Mat, double> > solvePnP_(float size, const std::vector
                                                   std::make_pair(getRTMatrix(Rvec2, Tvec2, CV_32F), reprojErr2)};
 }
 
+std::vector<std::pair<cv::Mat, double> > solvePnP_(float size, const std::vector<cv::Point2f> &imgPoints,
+                                                   const PreparedCamera &camera)
+{
+  // the points are given in normalized coordinates, so that they are the same for the identity camera matrix
+  std::vector<cv::Point2f> normalized;
+  camera.undistortPoints(imgPoints, normalized);
+  cv::Mat Rvec, Tvec, Rvec2, Tvec2;
+  float reprojErr1, reprojErr2;
+  solvePoseOfCentredSquare(size, normalized, cv::Matx33d::eye(), cv::noArray(), Rvec, Tvec, reprojErr1, Rvec2, Tvec2,
+                           reprojErr2);
+  return std::vector<std::pair<cv::Mat, double>> {std::make_pair(getRTMatrix(Rvec, Tvec, CV_32F), reprojErr1),
+                                                  std::make_pair(getRTMatrix(Rvec2, Tvec2, CV_32F), reprojErr2)};
+}
+
 std::vector<std::pair<cv::Mat, double>> solvePnP_(const std::vector<cv::Point3f>& objPoints,
                                                   const std::vector<cv::Point2f>& imgPoints,
                                                   cv::InputArray cameraMatrix, cv::InputArray distCoeffs)
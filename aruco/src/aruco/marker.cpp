@@ -35,8 +35,10 @@
 #include <opencv2/imgproc.hpp>
 
 #include <cstdio>
+#include <limits>
 #include <math.h>
 #include "cameraparameters.h"
+#include "ippe.h"
 
 namespace aruco
 {
@@ -48,6 +50,7 @@ Marker::Marker()
 {
   id = -1;
   ssize = -1;
+  poseErrorRatio = 0;
   Rvec.create(3, 1, CV_32FC1);
   Tvec.create(3, 1, CV_32FC1);
   for (int i = 0; i < 3; i++)
@@ -61,6 +64,7 @@ Marker::Marker(int _id)
 {
   id = _id;
   ssize = -1;
+  poseErrorRatio = 0;
   Rvec.create(3, 1, CV_32FC1);
   Tvec.create(3, 1, CV_32FC1);
   for (int i = 0; i < 3; i++)
@@ -84,6 +88,7 @@ Marker::Marker(const std::vector<cv::Point2f>& corners, int _id) :
 {
   id = _id;
   ssize = -1;
+  poseErrorRatio = 0;
   Rvec.create(3, 1, CV_32FC1);
   Tvec.create(3, 1, CV_32FC1);
   for (int i = 0; i < 3; i++)
@@ -100,6 +105,9 @@ void Marker::copyTo(Marker &m) const
   // matrices of rotation and translation respect to the camera
   Rvec.copyTo(m.Rvec);
   Tvec.copyTo(m.Tvec);
+  Rvec2.copyTo(m.Rvec2);
+  Tvec2.copyTo(m.Tvec2);
+  m.poseErrorRatio = poseErrorRatio;
   m.resize(size());
   for (std::size_t i = 0; i < size(); i++)
     m.at(i) = at(i);
@@ -319,23 +327,74 @@ void Marker::calculateExtrinsics(float markerSize, const CameraParameters& CP, b
   calculateExtrinsics(markerSize, CP.CameraMatrix, CP.Distorsion, CP.ExtrinsicMatrix, setYPerpendicular);
 }
 
-void print(cv::Point3f p, std::string cad)
+void Marker::calculateExtrinsics(float markerSizeMeters, const PreparedCamera& camera, bool setYPerpendicular,
+                                 bool correctFisheye)
 {
-  std::cout << cad << " " << p.x << " " << p.y << " " << p.z << std::endl;
+  if (!isValid())
+    throw cv::Exception(9004, "!isValid(): invalid marker. It is not possible to calculate extrinsics",
+                        "calculateExtrinsics", __FILE__, __LINE__);
+  if (markerSizeMeters <= 0)
+    throw cv::Exception(9004, "markerSize<=0: invalid markerSize", "calculateExtrinsics", __FILE__, __LINE__);
+  if (!camera.isValid())
+    throw cv::Exception(9004, "the camera has not been prepared", "calculateExtrinsics", __FILE__, __LINE__);
+
+  solvePose(markerSizeMeters, camera.CameraMatrix64, camera.Distorsion64, correctFisheye);
+  Tvec.at<float>(0) += camera.Offset.x;
+  Tvec.at<float>(1) += camera.Offset.y;
+  Tvec.at<float>(2) += camera.Offset.z;
+
+  // rotate the X axis so that Y is perpendicular to the marker plane
+  if (setYPerpendicular)
+    rotateXAxis(Rvec);
+  ssize = markerSizeMeters;
 }
 
-/**
- */
-void Marker::calculateExtrinsics(float markerSizeMeters, cv::Mat camMatrix, cv::Mat distCoeff, cv::Mat Extrinsics, bool setYPerpendicular, bool correctFisheye)
+void Marker::calculateExtrinsicsIPPE(float markerSizeMeters, const PreparedCamera& camera, bool setYPerpendicular,
+                                     bool refine)
 {
   if (!isValid())
     throw cv::Exception(9004, "!isValid(): invalid marker. It is not possible to calculate extrinsics",
-                        "calculateExtrinsics", __FILE__, __LINE__);
+                        "calculateExtrinsicsIPPE", __FILE__, __LINE__);
   if (markerSizeMeters <= 0)
-    throw cv::Exception(9004, "markerSize<=0: invalid markerSize", "calculateExtrinsics", __FILE__, __LINE__);
-  if (camMatrix.rows == 0 || camMatrix.cols == 0)
-    throw cv::Exception(9004, "CameraMatrix is empty", "calculateExtrinsics", __FILE__, __LINE__);
+    throw cv::Exception(9004, "markerSize<=0: invalid markerSize", "calculateExtrinsicsIPPE", __FILE__, __LINE__);
+  if (!camera.isValid())
+    throw cv::Exception(9004, "the camera has not been prepared", "calculateExtrinsicsIPPE", __FILE__, __LINE__);
+
+  // IPPE works with normalized coordinates, so the identity camera matrix is passed
+  std::vector<cv::Point2f> normalized;
+  camera.undistortPoints(*this, normalized);
+  cv::Mat raux, taux, raux2, taux2;
+  float err, err2;
+  solvePoseOfCentredSquare(markerSizeMeters, normalized, cv::Matx33d::eye(), cv::noArray(), raux, taux, err, raux2,
+                           taux2, err2);
+  raux.convertTo(Rvec, CV_32F);
+  taux.convertTo(Tvec, CV_32F);
+  raux2.convertTo(Rvec2, CV_32F);
+  taux2.convertTo(Tvec2, CV_32F);
+  poseErrorRatio = err > 0 ? err2 / err : std::numeric_limits<float>::max();
+
+  if (refine)
+    refinePnP(get3DPoints(markerSizeMeters), *this, camera.CameraMatrix, camera.Distorsion, Rvec, Tvec);
+
+  for (cv::Mat *T : {&Tvec, &Tvec2})
+  {
+    T->at<float>(0) += camera.Offset.x;
+    T->at<float>(1) += camera.Offset.y;
+    T->at<float>(2) += camera.Offset.z;
+  }
+
+  // rotate the X axis so that Y is perpendicular to the marker plane
+  if (setYPerpendicular)
+  {
+    rotateXAxis(Rvec);
+    rotateXAxis(Rvec2);
+  }
+  ssize = markerSizeMeters;
+}
 
+void Marker::solvePose(float markerSizeMeters, const cv::Mat& camMatrix, const cv::Mat& distCoeff,
+                       bool correctFisheye)
+{
   std::vector<cv::Point3f> objpoints = get3DPoints(markerSizeMeters);
 
   cv::Mat raux, taux;
@@ -351,6 +410,30 @@ void Marker::calculateExtrinsics(float markerSizeMeters, cv::Mat camMatrix, cv::
   }
   raux.convertTo(Rvec, CV_32F);
   taux.convertTo(Tvec, CV_32F);
+  // the second solution is only computed by IPPE
+  poseErrorRatio = 0;
+  Rvec2.release();
+  Tvec2.release();
+}
+
+void print(cv::Point3f p, std::string cad)
+{
+  std::cout << cad << " " << p.x << " " << p.y << " " << p.z << std::endl;
+}
+
+/**
+ */
+void Marker::calculateExtrinsics(float markerSizeMeters, cv::Mat camMatrix, cv::Mat distCoeff, cv::Mat Extrinsics, bool setYPerpendicular, bool correctFisheye)
+{
+  if (!isValid())
+    throw cv::Exception(9004, "!isValid(): invalid marker. It is not possible to calculate extrinsics",
+                        "calculateExtrinsics", __FILE__, __LINE__);
+  if (markerSizeMeters <= 0)
+    throw cv::Exception(9004, "markerSize<=0: invalid markerSize", "calculateExtrinsics", __FILE__, __LINE__);
+  if (camMatrix.rows == 0 || camMatrix.cols == 0)
+    throw cv::Exception(9004, "CameraMatrix is empty", "calculateExtrinsics", __FILE__, __LINE__);
+
+  solvePose(markerSizeMeters, camMatrix, distCoeff, correctFisheye);
   float tx = -1 * (Extrinsics.at<double>(0,0) / camMatrix.at<float>(0,0));
   Tvec.at<float>(0) += tx;
   float ty = -1 * (Extrinsics.at<double>(0,1) / camMatrix.at<float>(1,1));
@@ -29,14 +29,18 @@
 #include "markerdetector.h"
 #include "cameraparameters.h"
 #include "markerlabeler.h"
+#include "threadpool.h"
 #include "timers.h"
 
 #include <opencv2/core.hpp>
+#include <opencv2/core/ocl.hpp>
 #include <opencv2/imgproc.hpp>
 #include <fstream>
 #include <iostream>
-#include <valarray>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <thread>
 #include "debug.h"
 
@@ -47,13 +51,231 @@
 namespace aruco
 {
 
+/**
+ * Reads the cells of a candidate through the homography that maps the unit square onto its corners
+ * (Heckbert's square to quad mapping). Only a few pixels per cell are interpolated, and the cells are
+ * binarized with the Otsu threshold of these samples, as done with the pixels of the canonical images
+ */
+class HomographyCellSampler : public MarkerCellSampler
+{
+public:
+  static const int samplesPerAxis = 3;
+
+  void setCandidate(const cv::Mat &grey, const cv::Point2f *p)
+  {
+    _grey = grey;
+    double sx = p[0].x - p[1].x + p[2].x - p[3].x;
+    double sy = p[0].y - p[1].y + p[2].y - p[3].y;
+    double g = 0, h = 0;
+    if (sx != 0 || sy != 0)
+    {
+      double dx1 = p[1].x - p[2].x, dx2 = p[3].x - p[2].x;
+      double dy1 = p[1].y - p[2].y, dy2 = p[3].y - p[2].y;
+      double den = dx1 * dy2 - dx2 * dy1;
+      if (den != 0)
+      {
+        g = (sx * dy2 - dx2 * sy) / den;
+        h = (dx1 * sy - sx * dy1) / den;
+      }
+    }
+    _H[0] = p[1].x - p[0].x + g * p[1].x;
+    _H[1] = p[3].x - p[0].x + h * p[3].x;
+    _H[2] = p[0].x;
+    _H[3] = p[1].y - p[0].y + g * p[1].y;
+    _H[4] = p[3].y - p[0].y + h * p[3].y;
+    _H[5] = p[0].y;
+    _H[6] = g;
+    _H[7] = h;
+  }
+
+  void getCells(int ndiv, uchar *cells)
+  {
+    const int spc = samplesPerAxis * samplesPerAxis;
+    _samples.resize(ndiv * ndiv * spc);
+    int hist[256] = {0};
+    std::size_t idx = 0;
+    const double step = 1. / double(ndiv * samplesPerAxis);
+    for (int cy = 0; cy < ndiv; cy++)
+      for (int cx = 0; cx < ndiv; cx++)
+        for (int sy = 0; sy < samplesPerAxis; sy++)
+          for (int sx = 0; sx < samplesPerAxis; sx++)
+          {
+            uchar v = sample((cx * samplesPerAxis + sx + 0.5) * step, (cy * samplesPerAxis + sy + 0.5) * step);
+            _samples[idx++] = v;
+            hist[v]++;
+          }
+
+    int thres = otsu(hist, int(_samples.size()));
+    for (int c = 0; c < ndiv * ndiv; c++)
+    {
+      int nonZeros = 0;
+      for (int i = 0; i < spc; i++)
+        nonZeros += _samples[c * spc + i] > thres;
+      cells[c] = nonZeros > spc / 2;
+    }
+  }
+
+  // adds the samples of the last call to getCells(), so that the threshold can be updated as with the canonical images
+  void addToHistogram(std::vector<float> &hist) const
+  {
+    for (auto v : _samples)
+      hist[v]++;
+  }
+
+private:
+  // bilinear interpolation of the point (u,v) of the unit square
+  uchar sample(double u, double v) const
+  {
+    double w = _H[6] * u + _H[7] * v + 1.;
+    float x = float((_H[0] * u + _H[1] * v + _H[2]) / w);
+    float y = float((_H[3] * u + _H[4] * v + _H[5]) / w);
+    x = std::min(std::max(x, 0.f), float(_grey.cols - 1));
+    y = std::min(std::max(y, 0.f), float(_grey.rows - 1));
+    int x0 = int(x), y0 = int(y);
+    int x1 = std::min(x0 + 1, _grey.cols - 1), y1 = std::min(y0 + 1, _grey.rows - 1);
+    float fx = x - x0, fy = y - y0;
+    const uchar *r0 = _grey.ptr<uchar>(y0), *r1 = _grey.ptr<uchar>(y1);
+    float top = r0[x0] + fx * (r0[x1] - r0[x0]);
+    float bottom = r1[x0] + fx * (r1[x1] - r1[x0]);
+    return uchar(top + fy * (bottom - top) + 0.5f);
+  }
+
+  // threshold maximizing the between class variance (values above it are white)
+  static int otsu(const int *hist, int total)
+  {
+    double sum = 0;
+    for (int t = 0; t < 256; t++)
+      sum += double(t) * hist[t];
+    double sumB = 0, maxVar = -1;
+    int wB = 0, best = 0;
+    for (int t = 0; t < 256; t++)
+    {
+      wB += hist[t];
+      if (wB == 0)
+        continue;
+      int wF = total - wB;
+      if (wF == 0)
+        break;
+      sumB += double(t) * hist[t];
+      double mB = sumB / wB, mF = (sum - sumB) / wF;
+      double var = double(wB) * double(wF) * (mB - mF) * (mB - mF);
+      if (var > maxVar)
+      {
+        maxVar = var;
+        best = t;
+      }
+    }
+    return best;
+  }
+
+  cv::Mat _grey;
+  double _H[8];
+  std::vector<uchar> _samples;
+};
+
+// buffers employed by each thread of the candidate classification
+struct ClassificationScratch
+{
+  HomographyCellSampler cellSampler;
+  cv::Mat canonicalMarker, canonicalMarkerAux;
+  std::vector<float> hist;
+  std::vector<cv::Point2f> points; // corners of the candidate in the pyramid image
+};
+
+// result of the classification of a candidate
+struct CandidateLabel
+{
+  bool isMarker = false;
+  int id = -1, nRotations = 0;
+  std::size_t pyramidLevel = 0; // level of the image pyramid the candidate is read from
+  std::string additionalInfo;
+};
+
+// buffers of detect() kept between frames, so that once an image of a given size has been processed, the next ones
+// of that size do not allocate them again
+struct MarkerDetector::Workspace
+{
+  cv::Mat imgToBeThresHolded; // downsampled image (if needed)
+  std::vector<int> thresParam1Values; // window sizes of the adaptive thresholds
+  std::vector<int> thresParam2Values; // constant subtracted to the mean, or the fixed threshold, of each image
+  std::vector<int> retryThresholds; // THRES_AUTO_FIXED: levels tried at once when none marker is found
+  std::vector<cv::Mat> unerodedImages; // thresholded images before eroding them (enclosed markers), one per window
+  // pixels of the grey image taken by convertToGreyAndDecimate, for the last sizes of the image and the decimated one
+  std::vector<int> decimationXofs, decimationYofs;
+  cv::Size decimationFrom, decimationTo;
+  std::vector<bool> toRemove; // prefiltered candidates and duplicated markers
+  std::vector<ClassificationScratch> scratch; // one per thread
+  std::vector<CandidateLabel> labels; // one per candidate
+  std::vector<cv::Mat> batchImages; // canonical images of the candidates (MarkerLabeler::detectBatch)
+  std::vector<MarkerLabeler::Label> batchLabels;
+  std::vector<float> hist; // of the markers found (THRES_AUTO_FIXED)
+  std::vector<Marker> regionMarkers; // markers found in a region of interest (DM_TRACKING)
+  PreparedCamera camera; // camera parameters for the size of the last image, used to estimate the poses
+  cv::UMat deviceImage; // image to threshold, in the OpenCL device (Params::useOpenCL)
+  std::vector<cv::UMat> deviceThres, deviceEroded; // one per window size
+
+  // motion gate (Params::motionGate): block means of the current frame, and of the last frame detected in each block
+  cv::Mat gateBlocks, gateReference, gateDiff, gateMask;
+  cv::Size gateImageSize; // size of the image of gateReference, empty if there is no reference
+  int gateFramesSinceFull = 0;
+  std::vector<std::vector<cv::Point>> gateContours; // of the groups of changed blocks
+  std::vector<cv::Rect> gateRegions;
+  std::vector<Marker> gateMarkers; // markers of the previous frame
+  std::vector<bool> gateInRegion; // the previous marker is inside a changed region, so it is detected again
+  std::vector<Marker> gateReused; // previous markers kept in the current frame
+
+  // stats of the frame being detected, and of the last frames in a ring buffer protected by statsMutex
+  FrameStats stats;
+  std::chrono::steady_clock::time_point lastMark;
+  std::array<FrameStats, frameStatsHistorySize> statsHistory;
+  uint64_t frames = 0;
+  std::mutex statsMutex;
+
+  // computes the decimation tables as cv::resize does with INTER_NEAREST, only if the sizes have changed
+  void updateDecimationTables(cv::Size from, cv::Size to)
+  {
+    if (from == decimationFrom && to == decimationTo)
+      return;
+    decimationFrom = from;
+    decimationTo = to;
+    double ifx = 1. / (double(to.width) / from.width), ify = 1. / (double(to.height) / from.height);
+    decimationXofs.resize(to.width);
+    decimationYofs.resize(to.height);
+    for (int x = 0; x < to.width; x++)
+      decimationXofs[x] = std::min(cvFloor(x * ifx), from.width - 1);
+    for (int y = 0; y < to.height; y++)
+      decimationYofs[y] = std::min(cvFloor(y * ify), from.height - 1);
+  }
+
+  // adds the time since the previous mark to the stage given
+  void mark(int stage)
+  {
+    auto now = std::chrono::steady_clock::now();
+    stats.ms[stage] += std::chrono::duration<double, std::milli>(now - lastMark).count();
+    lastMark = now;
+  }
+};
+
+const int MarkerDetector::frameStatsHistorySize;
+
+// returns the element n of v, which must have at least n elements, appending it if needed. Reusing the elements
+// there since the previous frame keeps their buffers
+template<typename T>
+static T &reuseElement(std::vector<T> &v, std::size_t n)
+{
+  if (n == v.size())
+    v.emplace_back();
+  return v[n];
+}
+
 /**
  *
  *
  *
  *
  */
-MarkerDetector::MarkerDetector()
+MarkerDetector::MarkerDetector() :
+    _workspace(new Workspace)
 {
   markerIdDetector = aruco::MarkerLabeler::create(Dictionary::ALL_DICTS);
   setDetectionMode(DM_NORMAL);
@@ -65,7 +287,8 @@ MarkerDetector::MarkerDetector()
  *
  *
  */
-MarkerDetector::MarkerDetector(int dict_type, float error_correction_rate)
+MarkerDetector::MarkerDetector(int dict_type, float error_correction_rate) :
+    _workspace(new Workspace)
 {
   setDictionary(dict_type, error_correction_rate);
   setDetectionMode(DM_NORMAL);
@@ -77,7 +300,8 @@ MarkerDetector::MarkerDetector(int dict_type, float error_correction_rate)
  *
  *
  */
-MarkerDetector::MarkerDetector(std::string dict_type, float error_correction_rate)
+MarkerDetector::MarkerDetector(std::string dict_type, float error_correction_rate) :
+    _workspace(new Workspace)
 {
   setDictionary(dict_type, error_correction_rate);
   setDetectionMode(DM_NORMAL);
@@ -92,6 +316,40 @@ MarkerDetector::MarkerDetector(std::string dict_type, float error_correction_rat
  */
 MarkerDetector::~MarkerDetector()
 {
+  shutdownThreads();
+}
+
+void MarkerDetector::setThreadPool(cv::Ptr<ThreadPool> pool)
+{
+  shutdownThreads();
+  _threadPool = pool;
+  _sharedThreadPool = !pool.empty();
+}
+
+cv::Ptr<ThreadPool> MarkerDetector::getThreadPool()
+{
+  threadPool();
+  return _threadPool;
+}
+
+void MarkerDetector::shutdownThreads()
+{
+  if (!_threadPool.empty() && !_sharedThreadPool)
+    _threadPool->shutdown();
+  _threadPool = cv::Ptr<ThreadPool>();
+  _sharedThreadPool = false;
+}
+
+ThreadPool &MarkerDetector::threadPool()
+{
+  if (_threadPool.empty())
+  {
+    _threadPool = cv::makePtr<ThreadPool>(ThreadPool::workersFor(_params.maxThreads));
+    _sharedThreadPool = false;
+  }
+  else if (!_sharedThreadPool)
+    _threadPool->resize(ThreadPool::workersFor(_params.maxThreads));
+  return *_threadPool;
 }
 
 /**
@@ -116,11 +374,13 @@ void MarkerDetector::setDetectionMode(DetectionMode dm, float minMarkerSize)
     _params.setAutoSizeSpeedUp(false);
     _params.setThresholdMethod(THRES_AUTO_FIXED);
   }
-  else if (_detectMode == DM_VIDEO_FAST)
+  else if (_detectMode == DM_VIDEO_FAST || _detectMode == DM_TRACKING)
   {
     _params.setThresholdMethod(THRES_AUTO_FIXED);
     _params.setAutoSizeSpeedUp(true, 0.3);
   }
+  _trackedMarkers.clear();
+  _framesSinceFullScan = 0;
 }
 
 DetectionMode MarkerDetector::getDetectionMode()
@@ -155,15 +415,18 @@ std::vector<aruco::Marker> MarkerDetector::detect(const cv::Mat& input, const Ca
  *
  *
  */
-void MarkerDetector::detect(const cv::Mat& input, std::vector<Marker>& detectedMarkers, CameraParameters camParams,
-                            float markerSizeMeters, bool setYPerpendicular, bool correctFisheye)
+void MarkerDetector::detect(const cv::Mat& input, std::vector<Marker>& detectedMarkers,
+                            const CameraParameters& camParams, float markerSizeMeters, bool setYPerpendicular,
+                            bool correctFisheye)
 {
-  if (camParams.CamSize != input.size() && camParams.isValid() && markerSizeMeters > 0)
+  if (camParams.isValid() && markerSizeMeters > 0)
   {
-    // must resize camera parameters if we want to compute properly marker poses
-    CameraParameters cp_aux = camParams;
-    cp_aux.resize(input.size());
-    detect(input, detectedMarkers, cp_aux.CameraMatrix, cp_aux.Distorsion, cp_aux.ExtrinsicMatrix, markerSizeMeters, setYPerpendicular, correctFisheye);
+    // the parameters are resized to the input only when they or its size change. The prepared matrices are
+    // recognized by the detection below, that does not prepare the camera again
+    PreparedCamera &camera = _workspace->camera;
+    camera.prepare(camParams, input.size());
+    detect(input, detectedMarkers, camera.CameraMatrix64, camera.Distorsion64, camera.ExtrinsicMatrix,
+           markerSizeMeters, setYPerpendicular, correctFisheye);
   }
   else
   {
@@ -184,7 +447,7 @@ int MarkerDetector::getMarkerWarpSize()
   return _params._markerWarpPixSize * ndiv; // this is the minimum size that the smallest marker will have
 }
 
-void MarkerDetector::buildPyramid(std::vector<cv::Mat> &ImagePyramid, const cv::Mat &grey_img, int minSize)
+void MarkerDetector::resetPyramid(const cv::Mat &grey_img, int minSize)
 {
   // determine number of pyramid images
   int npyrimg = 1;
@@ -195,62 +458,87 @@ void MarkerDetector::buildPyramid(std::vector<cv::Mat> &ImagePyramid, const cv::
     npyrimg++;
   }
 
-  ImagePyramid.resize(npyrimg);
+  imagePyramid.resize(npyrimg);
   imagePyramid[0] = grey_img;
+  _pyramidLevelsBuilt = 1;
 
-  // now, create pyramid images
-  imgpsize = grey_img.size();
+  // the levels get their size now, so that it can be known without building them. The buffers of the previous
+  // frame are kept if the size has not changed
   for (int i = 1; i < npyrimg; i++)
   {
-    cv::Size nsize(ImagePyramid[i - 1].cols / _params.pyrfactor, ImagePyramid[i - 1].rows / _params.pyrfactor);
-    cv::resize(ImagePyramid[i - 1], ImagePyramid[i], nsize);
+    cv::Size nsize(imagePyramid[i - 1].cols / _params.pyrfactor, imagePyramid[i - 1].rows / _params.pyrfactor);
+    imagePyramid[i].create(nsize, grey_img.type());
+  }
+}
+
+void MarkerDetector::buildPyramidLevels(std::size_t level)
+{
+  level = std::min(level, imagePyramid.size() - 1);
+  for (; _pyramidLevelsBuilt <= level; _pyramidLevelsBuilt++)
+  {
+    const cv::Mat &finer = imagePyramid[_pyramidLevelsBuilt - 1];
+    cv::Mat &coarser = imagePyramid[_pyramidLevelsBuilt];
+    cv::resize(finer, coarser, coarser.size());
   }
 }
 
 /**
  *
  */
-std::vector<MarkerDetector::MarkerCandidate> MarkerDetector::thresholdAndDetectRectangles(const cv::Mat & input,
-                                                                                          int thres_param1,
-                                                                                          int thres_param2, bool erode,
-                                                                                          cv::Mat &auxThresImage)
+// the window of the adaptive thresholds must be odd, and at least 3
+static int adaptiveWindowSize(int thres_param1)
 {
-  // ensure that _thresParam1 % 2 == 1
-  ScopedTimerEvents tev("hafc " + std::to_string(thres_param1));
   if (thres_param1 < 3)
-    thres_param1 = 3;
-  else if (((int)thres_param1) % 2 != 1)
-    thres_param1 = (int)(thres_param1 + 1);
+    return 3;
+  if (thres_param1 % 2 != 1)
+    return thres_param1 + 1;
+  return thres_param1;
+}
 
-  cv::Mat auxImage;
-  if (!erode)
-    auxImage = auxThresImage;
-  if (_params._thresMethod == THRES_AUTO_FIXED)
-  {
-    cv::threshold(input, auxImage, static_cast<int>(thres_param2), 255, cv::THRESH_BINARY_INV);
-  }
-  else
-    cv::adaptiveThreshold(input, auxImage, 255., cv::ADAPTIVE_THRESH_MEAN_C, cv::THRESH_BINARY_INV,
-                          static_cast<int>(thres_param1), static_cast<int>(thres_param2));
-  tev.add("thres");
+// kernel of the erosion of the thresholded images (enclosed markers), created once
+static const cv::Mat &erodeKernel()
+{
+  static const cv::Mat kernel = cv::getStructuringElement(cv::MORPH_CROSS, cv::Size(3, 3), cv::Point(1, 1));
+  return kernel;
+}
 
-  if (erode)
+void MarkerDetector::thresholdAndDetectRectangles(const cv::Mat & input, int thres_param1, int thres_param2, bool erode,
+                                                  bool thresholded, cv::Mat &auxThresImage, cv::Mat &unerodedImage,
+                                                  QuadExtractor &quadExtractor, CandidateCorners &MarkerCanditates)
+{
+  // the same label for every window size, so that no string is built per task
+  ScopedTimerEvents tev("hafc");
+  if (!thresholded)
   {
-    cv::erode(auxImage, auxThresImage, getStructuringElement(cv::MORPH_CROSS, cv::Size(3, 3), cv::Point(1, 1)));
-    tev.add("erode");
+    thres_param1 = adaptiveWindowSize(thres_param1);
+    cv::Mat &auxImage = erode ? unerodedImage : auxThresImage;
+    if (_params._thresMethod == THRES_AUTO_FIXED)
+    {
+      cv::threshold(input, auxImage, static_cast<int>(thres_param2), 255, cv::THRESH_BINARY_INV);
+    }
+    else if (_params._thresMethod == THRES_ADAPTIVE_INTEGRAL)
+      integralAdaptiveThreshold(input, thres_param1, thres_param2, auxImage);
+    else
+      cv::adaptiveThreshold(input, auxImage, 255., cv::ADAPTIVE_THRESH_MEAN_C, cv::THRESH_BINARY_INV,
+                            static_cast<int>(thres_param1), static_cast<int>(thres_param2));
+    tev.add("thres");
+
+    if (erode)
+    {
+      cv::erode(auxImage, auxThresImage, erodeKernel());
+      tev.add("erode");
+    }
   }
 
-  std::vector<MarkerCandidate> MarkerCanditates;
+  MarkerCanditates.clear();
 
   // calculate the min_max contour sizes
   int thisImageMinSize = int(3.5 * float(_params.lowResMarkerSize));
 
-  // if image is eroded, minSize must be adapted
-  std::vector<cv::Vec4i> hierarchy;
-  std::vector<std::vector<cv::Point>> contours;
-  cv::findContours(auxThresImage, contours, cv::noArray(), cv::RETR_LIST, cv::CHAIN_APPROX_NONE);
-  tev.add("find-cont");
-  std::vector<cv::Point> approxCurve;
+  // follow the borders of the thresholded image and keep those that can be approximated to a convex rect.
+  // Contours not larger enough are discarded while following them
+  const std::vector<cv::Point> &approxCurves = quadExtractor.extract(auxThresImage, thisImageMinSize, 0.05);
+  tev.add("find-quads");
 
 //#define _aruco_debug_detectrectangles
 #ifdef _aruco_debug_detectrectangles
@@ -258,241 +546,338 @@ std::vector<MarkerDetector::MarkerCandidate> MarkerDetector::thresholdAndDetectR
   cv::cvtColor(input,simage,cv::COLOR_GRAY2BGR);
 #endif
 
-  // for each contour, analyze if it is a parallelepiped likely to be the marker
-  for (unsigned int i = 0; i < contours.size(); i++)
+  for (std::size_t i = 0; i + 3 < approxCurves.size(); i += 4)
   {
+    // add the points
+    for (int j = 0; j < 4; j++)
+      MarkerCanditates.push_back(
+          cv::Point2f(static_cast<float>(approxCurves[i + j].x), static_cast<float>(approxCurves[i + j].y)));
 
-#ifdef _aruco_debug_detectrectangles
-    drawContour(simage, contours[i], Scalar(125, 125, 255) );
-#endif
-
-    // check it is a possible element by first checking that is is large enough
-    if (thisImageMinSize < int(contours[i].size()))
+    // now, if it is eroded, must enlarge 1 bit the corners to go to the real location
+    if (erode)
     {
-      // can approximate to a convex rect?
-      cv::approxPolyDP(contours[i], approxCurve, double(contours[i].size()) * 0.05, true);
-
-      if (approxCurve.size() == 4 && cv::isContourConvex(approxCurve))
-      {
-
-#ifdef _aruco_debug_detectrectangles
-        drawApproxCurve(simage, approxCurve, Scalar(255, 0, 255),1);
-#endif
-
-        // ensure that the distance between consecutive points is large enough
-        float minDist = std::numeric_limits<float>::max();
-        for (int j = 0; j < 4; j++)
-        {
-          float d = cv::norm(approxCurve[j] - approxCurve[(j + 1) % 4]);
-          if (d < minDist)
-            minDist = d;
-        }
-
-        // add the points
-        MarkerCanditates.push_back(MarkerCandidate());
-        for (int j = 0; j < 4; j++)
-          MarkerCanditates.back().push_back(
-              cv::Point2f(static_cast<float>(approxCurve[j].x), static_cast<float>(approxCurve[j].y)));
-
-        // now, if it is eroded, must enlarge 1 bit the corners to go to the real location
-        if (erode)
-        {
-          // for each opposite pair, take the line joining them and move one pixel apart
-          // ideally, Bresenham's algorithm should be used
-          enlargeMarkerCandidate(MarkerCanditates.back(), 1);
-        }
+      // for each opposite pair, take the line joining them and move one pixel apart
+      // ideally, Bresenham's algorithm should be used
+      enlargeMarkerCandidate(&MarkerCanditates[MarkerCanditates.size() - 4], 1);
+    }
 
 #ifdef _aruco_debug_detectrectangles
-        MarkerCanditates.back().draw(simage,Scalar(255, 255, 0),1,false);
+    Marker(std::vector<cv::Point2f>(MarkerCanditates.end() - 4, MarkerCanditates.end())).draw(simage,cv::Scalar(255, 255, 0),1,false);
 #endif
-
-      }
-    }
   }
 
 #ifdef _aruco_debug_detectrectangles
   cv::imshow("contours",simage);
 #endif
-
-  return MarkerCanditates;
 }
 
-void MarkerDetector::thresholdAndDetectRectangles_thread()
+/**
+ * Same rule as cv::adaptiveThreshold(ADAPTIVE_THRESH_MEAN_C, THRESH_BINARY_INV), with the mean of each window
+ * obtained from _integralImage. As OpenCV does, the mean is rounded to an integer and pixels are set to 255 if
+ * input(x,y) <= mean - C. Since both sides are integers, that is (input(x,y) + C) * area <= sum + area / 2, that
+ * needs no division. Near the borders the mean is computed only with the pixels inside the image, while OpenCV
+ * replicates the border pixels
+ */
+void MarkerDetector::integralAdaptiveThreshold(const cv::Mat &input, int wsize, int C, cv::Mat &out) const
 {
-  while (true)
+  CV_Assert(input.type() == CV_8UC1 && _integralImage.rows == input.rows + 1 && _integralImage.cols == input.cols + 1);
+  out.create(input.size(), CV_8UC1);
+  const int r = wsize / 2;
+  const int cols = input.cols;
+  // columns in which the window is entirely inside the image
+  const int xstart = std::min(r, cols), xend = std::max(xstart, cols - r);
+
+  for (int y = 0; y < input.rows; y++)
   {
-//    std::stringstream sstr;
-//    sstr << "thread-" << std::this_thread::get_id() << " "
-//        << std::chrono::high_resolution_clock::now().time_since_epoch().count();
-//    ScopedTimerEvents tev(sstr.str());
-    bool erode = false;
-    auto tad = _tasks.pop();
-//    tev.add("pop");
-    if (tad.task == EXIT_TASK)
-      return;
-    else if (tad.task == ERODE_TASK)
-      erode = true;
-    _vcandidates[tad.outIdx] = thresholdAndDetectRectangles(_thres_Images[tad.inIdx], tad.param1, tad.param2, erode,
-                                                            _thres_Images[tad.outIdx]);
-//    tev.add("thres param: "+to_string(tad.param1));
+    const int y0 = std::max(0, y - r), y1 = std::min(input.rows, y + r + 1);
+    // sums are read as unsigned, so that they are right even if the integral of a large image overflows
+    const uint32_t *top = _integralImage.ptr<uint32_t>(y0);
+    const uint32_t *bottom = _integralImage.ptr<uint32_t>(y1);
+    const uchar *in = input.ptr<uchar>(y);
+    uchar *o = out.ptr<uchar>(y);
+
+    auto border = [&](int x)
+    {
+      int x0 = std::max(0, x - r), x1 = std::min(cols, x + r + 1);
+      int area = (x1 - x0) * (y1 - y0);
+      int sum = int(bottom[x1] - bottom[x0] - top[x1] + top[x0]);
+      o[x] = (int(in[x]) + C) * area <= sum + area / 2 ? 255 : 0;
+    };
+
+    for (int x = 0; x < xstart; x++)
+      border(x);
+    // constant area in the central part. This loop is kept simple so that the compiler can vectorize it
+    const int area = (2 * r + 1) * (y1 - y0);
+    const int carea = C * area, halfArea = area / 2;
+    for (int x = xstart; x < xend; x++)
+    {
+      int sum = int(bottom[x + r + 1] - bottom[x - r] - top[x + r + 1] + top[x - r]);
+      o[x] = int(in[x]) * area + carea <= sum + halfArea ? 255 : 0;
+    }
+    for (int x = xend; x < cols; x++)
+      border(x);
   }
 }
 
-std::vector<aruco::MarkerDetector::MarkerCandidate> MarkerDetector::thresholdAndDetectRectangles(const cv::Mat &image)
+void MarkerDetector::thresholdAndDetectRectangles(const cv::Mat &image, CandidateCorners &MarkerCanditates,
+                                                  const std::vector<int> &fixedThresholds)
 {
-  // compute the different values of param1
-  std::vector<int> p1_values;
-  for (int i =
-      static_cast<int>(std::max(3., _params._AdaptiveThresWindowSize - 2. * _params._AdaptiveThresWindowSize_range));
-      i <= _params._AdaptiveThresWindowSize + 2 * _params._AdaptiveThresWindowSize_range; i += 2)
-    p1_values.push_back(i);
+  // compute the different values of param1, and param2 for each one
+  std::vector<int> &p1_values = _workspace->thresParam1Values;
+  std::vector<int> &p2_values = _workspace->thresParam2Values;
+  p1_values.clear();
+  p2_values.clear();
+  if (fixedThresholds.empty())
+  {
+    for (int i =
+        static_cast<int>(std::max(3., _params._AdaptiveThresWindowSize - 2. * _params._AdaptiveThresWindowSize_range));
+        i <= _params._AdaptiveThresWindowSize + 2 * _params._AdaptiveThresWindowSize_range; i += 2)
+    {
+      p1_values.push_back(i);
+      p2_values.push_back(_params._ThresHold);
+    }
+  }
+  else
+  {
+    // the window is not used by the fixed threshold
+    p1_values.assign(fixedThresholds.size(), _params._AdaptiveThresWindowSize);
+    p2_values = fixedThresholds;
+  }
 
   std::size_t nimages = p1_values.size();
   _vcandidates.resize(nimages);
+  _quadExtractors.resize(nimages);
   _thres_Images.resize(nimages + 1);
   _thres_Images.back() = image; // add at the end the original image
 
-  // first, thresholded images
-  ThresAndDetectRectTASK tad;
-  std::vector<ThresAndDetectRectTASK> vtad;
-
-  ThreadTasks task = THRESHOLD_TASK;
-  if (_params.enclosedMarker)
-    task = ERODE_TASK;
-  for (std::size_t i = 0; i < p1_values.size(); i++)
-  {
-    tad.inIdx = int(_thres_Images.size() - 1);
-    tad.param1 = p1_values[i];
-    tad.param2 = _params._ThresHold;
-    tad.outIdx = i;
-    tad.task = task;
-    _tasks.push(tad);
-    vtad.push_back(tad);
-  }
-
-  // reserve images
+  // reserve images, that keep their buffers while the size does not change
+  const bool erode = _params.enclosedMarker;
+  std::vector<cv::Mat> &uneroded = _workspace->unerodedImages;
+  if (erode)
+    uneroded.resize(nimages);
   for (std::size_t i = 0; i < nimages; i++)
+  {
     _thres_Images[i].create(image.size(), CV_8UC1);
+    if (erode)
+      uneroded[i].create(image.size(), CV_8UC1);
+  }
 
-  // how many threads will be used?
-  int nthreads = 0;
-  if (_params.maxThreads <= 0) // if allowed to use all , take max()-1, since the buildpyramid must be working at this moment
-    nthreads = std::thread::hardware_concurrency() - 1;
-  else
-    nthreads = std::max(1, _params.maxThreads - 1);
+  const bool thresholded = _params.useOpenCL && cv::ocl::useOpenCL();
+  if (thresholded)
+    thresholdInDevice(image, erode);
+  else if (_params._thresMethod == THRES_ADAPTIVE_INTEGRAL)
+    cv::integral(image, _integralImage, CV_32S); // the sums are computed only once for all the window sizes
 
-  tad.task = EXIT_TASK;
-  for (int i = 0; i < nthreads; i++)
-    _tasks.push(tad);
+  // one task per thresholded image. The lambda only captures this and two flags, so it is stored in the
+  // std::function without allocating
+  auto task = [this, erode, thresholded](std::size_t i)
+  {
+    thresholdAndDetectRectangles(_thres_Images.back(), _workspace->thresParam1Values[i],
+                                 _workspace->thresParam2Values[i], erode, thresholded, _thres_Images[i],
+                                 erode ? _workspace->unerodedImages[i] : _thres_Images[i], _quadExtractors[i],
+                                 _vcandidates[i]);
+  };
 
-  if (nthreads == 1)
   {
-    // no threads
-    ScopeTimer Timer("non-parallel");
-    thresholdAndDetectRectangles_thread();
+    // run the tasks (in parallel if the pool has workers)
+    ScopeTimer Timer("threshold-tasks");
+    threadPool().run(nimages, task);
   }
-  else
-  {
-    // parallell mode
-    // add the final task END
-    ScopeTimer Timer("parallel");
 
-    // run the tasks (in parallel)
-    std::vector<std::thread> threads;
-    for (int i = 0; i < nthreads; i++)
-      threads.push_back(std::thread(&MarkerDetector::thresholdAndDetectRectangles_thread, this));
+  joinVectors(_vcandidates, MarkerCanditates, true);
+}
 
-    // wait for them to finish
-    for (auto &th : threads)
-      th.join();
+void MarkerDetector::thresholdInDevice(const cv::Mat &image, bool erode)
+{
+  ScopeTimer Timer("threshold-device");
+  Workspace &ws = *_workspace;
+  const std::vector<int> &p1_values = ws.thresParam1Values;
+  const std::vector<int> &p2_values = ws.thresParam2Values;
+  ws.deviceThres.resize(p1_values.size());
+  ws.deviceEroded.resize(p1_values.size());
+  image.copyTo(ws.deviceImage);
+
+  // all the images are queued before downloading any of them, so that the device does not wait for the host. The
+  // integral threshold is computed as the adaptive one it is equivalent to
+  for (std::size_t i = 0; i < p1_values.size(); i++)
+  {
+    if (_params._thresMethod == THRES_AUTO_FIXED)
+      cv::threshold(ws.deviceImage, ws.deviceThres[i], p2_values[i], 255, cv::THRESH_BINARY_INV);
+    else
+      cv::adaptiveThreshold(ws.deviceImage, ws.deviceThres[i], 255., cv::ADAPTIVE_THRESH_MEAN_C,
+                            cv::THRESH_BINARY_INV, adaptiveWindowSize(p1_values[i]), p2_values[i]);
+    if (erode)
+      cv::erode(ws.deviceThres[i], ws.deviceEroded[i],
+                erodeKernel());
   }
+  // the contours are followed in the host
+  for (std::size_t i = 0; i < p1_values.size(); i++)
+    (erode ? ws.deviceEroded[i] : ws.deviceThres[i]).copyTo(_thres_Images[i]);
+}
 
-  std::vector<MarkerCandidate> joined;
-  joinVectors(_vcandidates, joined);
-  return joined;
+// THRES_AUTO_FIXED: n thresholds to try when none marker is found with the one tried. They are quantiles of the grey
+// levels of the image, evenly spaced, so that they are spread over the levels actually present in it. Levels too
+// near the one tried, or the previous one, are skipped
+static void spreadThresholds(const cv::Mat &image, int n, int tried, std::vector<int> &thresholds)
+{
+  const int minGap = 8;
+  thresholds.clear();
+  if (n <= 0 || image.empty())
+    return;
+  int hist[256] = {};
+  for (int y = 0; y < image.rows; y++)
+  {
+    const uchar *p = image.ptr<uchar>(y);
+    for (int x = 0; x < image.cols; x++)
+      hist[p[x]]++;
+  }
+
+  const double total = double(image.rows) * image.cols;
+  double acc = 0;
+  int level = 0;
+  for (int k = 1; k <= n; k++)
+  {
+    double target = total * k / (n + 1);
+    while (level < 255 && acc + hist[level] < target)
+      acc += hist[level++];
+    if (std::abs(level - tried) >= minGap && (thresholds.empty() || level - thresholds.back() >= minGap))
+      thresholds.push_back(level);
+  }
 }
 
-std::vector<MarkerDetector::MarkerCandidate> MarkerDetector::prefilterCandidates(
-    std::vector<aruco::MarkerDetector::MarkerCandidate> &MarkerCanditates, cv::Size imgSize)
+void MarkerDetector::prefilterCandidates(CandidateCorners &MarkerCanditates, cv::Size imgSize)
 {
   /***********************************************************************************************
    * CANDIDATE PREFILTERING- Merge and Remove candidates so that only reliable ones are returned *
    ***********************************************************************************************/
+  const int ncandidates = int(MarkerCanditates.size() / 4);
 
   // sort the points in anti-clockwise order
-  std::valarray<bool> swapped(false, MarkerCanditates.size()); // used later
-  for (unsigned int i = 0; i < MarkerCanditates.size(); i++)
+  for (int i = 0; i < ncandidates; i++)
   {
+    cv::Point2f *cand = &MarkerCanditates[4 * i];
     // trace a line between the first and second point.
     // if the third point is at the right side, then the points are anti-clockwise
-    double dx1 = MarkerCanditates[i][1].x - MarkerCanditates[i][0].x;
-    double dy1 = MarkerCanditates[i][1].y - MarkerCanditates[i][0].y;
-    double dx2 = MarkerCanditates[i][2].x - MarkerCanditates[i][0].x;
-    double dy2 = MarkerCanditates[i][2].y - MarkerCanditates[i][0].y;
+    double dx1 = cand[1].x - cand[0].x;
+    double dy1 = cand[1].y - cand[0].y;
+    double dx2 = cand[2].x - cand[0].x;
+    double dy2 = cand[2].y - cand[0].y;
     double o = (dx1 * dy2) - (dy1 * dx2);
 
     if (o < 0.0)
     {
       // if the third point is in the left side, then sort in anti-clockwise order
-      std::swap(MarkerCanditates[i][1], MarkerCanditates[i][3]);
-      swapped[i] = true;
+      std::swap(cand[1], cand[3]);
     }
   }
 
-  // remove these elements which corners are too close to each other
-  // first detect candidates to be removed
-  std::vector<std::pair<int, int>> TooNearCandidates;
-  for (unsigned int i = 0; i < MarkerCanditates.size(); i++)
+  // remove these elements which corners are too close to each other.
+  // The candidates are placed in a grid according to their first corner, with cells as large as the distance
+  // considered too near, so each candidate is only compared with those in the 3x3 cells around it
+  const float nearDist = 6;
+  const int gridCols = std::max(1, int(imgSize.width / nearDist) + 1);
+  const int gridRows = std::max(1, int(imgSize.height / nearDist) + 1);
+  auto cellCoords = [&](const cv::Point2f &p, int &cx, int &cy)
   {
-    // calculate the average distance of each corner to the nearest corner of the other marker candidate
-    for (unsigned int j = i + 1; j < MarkerCanditates.size(); j++)
-    {
-      std::valarray<float> vdist(4);
-      for (int c = 0; c < 4; c++)
-        vdist[c] = cv::norm(MarkerCanditates[i][c] - MarkerCanditates[j][c]);
-
-      // if distance is too small
-      if (vdist[0] < 6 && vdist[1] < 6 && vdist[2] < 6 && vdist[3] < 6)
-        TooNearCandidates.push_back(std::pair<int, int>(i, j));
-    }
+    cx = std::min(gridCols - 1, std::max(0, int(p.x / nearDist)));
+    cy = std::min(gridRows - 1, std::max(0, int(p.y / nearDist)));
+  };
+
+  // counting sort of the candidates by cell
+  _gridCellStart.assign(gridCols * gridRows + 1, 0);
+  _candidateCell.resize(ncandidates);
+  _gridItems.resize(ncandidates);
+  for (int i = 0; i < ncandidates; i++)
+  {
+    int cx, cy;
+    cellCoords(MarkerCanditates[4 * i], cx, cy);
+    _candidateCell[i] = cy * gridCols + cx;
+    _gridCellStart[_candidateCell[i]]++;
   }
-
-  // mark for removal the element of  the pair with smaller perimeter
-  std::vector<bool> toRemove(MarkerCanditates.size(), false);
-  for (unsigned int i = 0; i < TooNearCandidates.size(); i++)
+  for (std::size_t c = 1; c < _gridCellStart.size(); c++)
+    _gridCellStart[c] += _gridCellStart[c - 1];
+  for (int i = ncandidates - 1; i >= 0; i--)
+    _gridItems[--_gridCellStart[_candidateCell[i]]] = i;
+
+  // mark for removal the element of the pair with smaller perimeter
+  std::vector<bool> &toRemove = _workspace->toRemove;
+  toRemove.assign(ncandidates, false);
+  const float nearDist2 = nearDist * nearDist;
+  for (int i = 0; i < ncandidates; i++)
   {
-    if (perimeter(MarkerCanditates[TooNearCandidates[i].first])
-        > perimeter(MarkerCanditates[TooNearCandidates[i].second]))
-      toRemove[TooNearCandidates[i].second] = true;
-    else
-      toRemove[TooNearCandidates[i].first] = true;
+    const cv::Point2f *ci = &MarkerCanditates[4 * i];
+    int cx, cy;
+    cellCoords(ci[0], cx, cy);
+    for (int y = std::max(0, cy - 1); y <= std::min(gridRows - 1, cy + 1); y++)
+      for (int x = std::max(0, cx - 1); x <= std::min(gridCols - 1, cx + 1); x++)
+      {
+        int cell = y * gridCols + x;
+        for (int k = _gridCellStart[cell]; k < _gridCellStart[cell + 1]; k++)
+        {
+          int j = _gridItems[k];
+          if (j <= i)
+            continue;
+          // if the distance between all corners is too small
+          const cv::Point2f *cj = &MarkerCanditates[4 * j];
+          bool tooNear = true;
+          for (int c = 0; c < 4 && tooNear; c++)
+          {
+            cv::Point2f d = ci[c] - cj[c];
+            tooNear = d.x * d.x + d.y * d.y < nearDist2;
+          }
+          if (tooNear)
+          {
+            if (perimeter(ci, 4) > perimeter(cj, 4))
+              toRemove[j] = true;
+            else
+              toRemove[i] = true;
+          }
+        }
+      }
   }
 
   // find these too near borders and remove them
   // remove markers with corners too near the image limits
   int borderDistThresX = static_cast<int>(_params.borderDistThres * float(imgSize.width));
   int borderDistThresY = static_cast<int>(_params.borderDistThres * float(imgSize.height));
-  for (std::size_t i = 0; i < MarkerCanditates.size(); i++)
+  for (int i = 0; i < ncandidates; i++)
   {
     // delete if any of the corners is too near image border
-    for (std::size_t c = 0; c < MarkerCanditates[i].size(); c++)
+    for (int c = 0; c < 4; c++)
     {
-      if (MarkerCanditates[i][c].x < borderDistThresX || MarkerCanditates[i][c].y < borderDistThresY
-          || MarkerCanditates[i][c].x > imgSize.width - borderDistThresX
-          || MarkerCanditates[i][c].y > imgSize.height - borderDistThresY)
+      const cv::Point2f &p = MarkerCanditates[4 * i + c];
+      if (p.x < borderDistThresX || p.y < borderDistThresY || p.x > imgSize.width - borderDistThresX
+          || p.y > imgSize.height - borderDistThresY)
       {
         toRemove[i] = true;
       }
     }
   }
 
-  // move to output only valid ones
-  std::vector<MarkerCandidate> finalCandidates;
-  finalCandidates.reserve(MarkerCanditates.size());
-  for (std::size_t i = 0; i < MarkerCanditates.size(); i++)
+  // keep only valid ones
+  int nvalid = 0;
+  for (int i = 0; i < ncandidates; i++)
+  {
     if (!toRemove[i])
-      finalCandidates.push_back(MarkerCanditates[i]);
-  return finalCandidates;
+    {
+      if (nvalid != i)
+        std::copy(&MarkerCanditates[4 * i], &MarkerCanditates[4 * i] + 4, &MarkerCanditates[4 * nvalid]);
+      nvalid++;
+    }
+  }
+  MarkerCanditates.resize(4 * nvalid);
+}
+
+// area of the quadrilateral, as in Marker::getArea
+static float candidateArea(const cv::Point2f *c)
+{
+  cv::Point2f v01 = c[1] - c[0];
+  cv::Point2f v03 = c[3] - c[0];
+  float area1 = std::fabs(v01.x * v03.y - v01.y * v03.x);
+  cv::Point2f v21 = c[1] - c[2];
+  cv::Point2f v23 = c[3] - c[2];
+  float area2 = std::fabs(v21.x * v23.y - v21.y * v23.x);
+  return (area2 + area1) / 2.f;
 }
 
 void addToImageHist(cv::Mat &im, std::vector<float>&hist)
@@ -552,81 +937,511 @@ int Otsu(std::vector<float> &hist)
 void MarkerDetector::detect(const cv::Mat& input, std::vector<Marker>& detectedMarkers, cv::Mat camMatrix,
                             cv::Mat distCoeff, cv::Mat extrinsics, float markerSizeMeters, bool setYPerpendicular, bool correctFisheye)
 {
-  // clear input data
-  detectedMarkers.clear();
-  _vcandidates.clear();
+  // the markers already in detectedMarkers are overwritten, so that their buffers are reused
   _candidates.clear();
   ScopedTimerEvents Timer("detect");
-
-  // it must be a 3 channel image
+  Workspace &ws = *_workspace;
+  ws.stats = FrameStats();
+  const auto frameStart = ws.lastMark = std::chrono::steady_clock::now();
+
+  std::vector<cv::Rect> rois;
+  if (_detectMode == DM_TRACKING)
+    rois = getTrackingROIs(input.size());
+  bool fullScan = rois.empty();
+
+  // it must be a 3 channel image. When the whole image is going to be downsampled to threshold it, this is done
+  // in the same pass
+  bool thresholdImageReady = false;
   if (input.type() == CV_8UC3)
-    cv::cvtColor(input, grey, cv::COLOR_BGR2GRAY);
-//  convertToGray(input, grey);
+  {
+    cv::Size thresholdImageSize = getThresholdImageSize(input.size(), input.size());
+    if (fullScan && thresholdImageSize != input.size())
+    {
+      ws.updateDecimationTables(input.size(), thresholdImageSize);
+      convertToGreyAndDecimate(input, grey, ws.imgToBeThresHolded, ws.decimationXofs, ws.decimationYofs,
+                               threadPool());
+      thresholdImageReady = true;
+    }
+    else
+      cv::cvtColor(input, grey, cv::COLOR_BGR2GRAY);
+  }
   else
     grey = input;
   Timer.add("ConvertGrey");
+  ws.mark(FrameStats::STAGE_CONVERT_GREY);
+
+  /*************************************************************************
+   * MOTION GATE, THE MARKERS IN THE BLOCKS THAT HAVE NOT CHANGED ARE KEPT *
+   *************************************************************************/
+  std::vector<Marker> &reused = ws.gateReused;
+  reused.clear();
+  bool gated = false;
+  if (_params.motionGate)
+  {
+    gated = getMotionGateROIs(grey, rois, reused);
+    if (gated)
+    {
+      fullScan = false;
+      ws.stats.count[FrameStats::COUNT_GATE_SKIPPED] = rois.empty() ? 1 : 0;
+      ws.stats.count[FrameStats::COUNT_GATE_REUSED] = static_cast<int>(reused.size());
+    }
+    Timer.add("Motion gate");
+    ws.mark(FrameStats::STAGE_MOTION_GATE);
+  }
+  else
+    ws.gateImageSize = cv::Size();
 
-  /*****************************************************************
-   * CREATE LOW RESOLUTION IMAGE IN WHICH MARKERS WILL BE DETECTED *
-   *****************************************************************/
+  /***********************************************************************
+   * DETECTION, IN THE REGIONS AROUND THE TRACKED MARKERS OR IN THE WHOLE *
+   ***********************************************************************/
+  if (!fullScan)
+  {
+    std::size_t ndetected = 0;
+    for (const auto &roi : rois)
+    {
+      std::size_t firstCandidate = _candidates.size();
+      std::vector<Marker> &roiMarkers = ws.regionMarkers;
+      detectInRegion(grey(roi), grey.size(), roiMarkers);
+      // move to the coordinates of the full image
+      cv::Point2f offset(static_cast<float>(roi.x), static_cast<float>(roi.y));
+      for (auto &m : roiMarkers)
+      {
+        for (auto &p : m)
+          p += offset;
+        reuseElement(detectedMarkers, ndetected++) = m;
+      }
+      for (std::size_t i = firstCandidate; i < _candidates.size(); i++)
+        _candidates[i] += offset;
+    }
+    detectedMarkers.resize(ndetected);
+    Timer.add("Detect in ROIs");
+
+    // if any of the tracked markers is lost, look for it in the whole image. Not with the motion gate, whose
+    // regions contain the previous markers that are not reused: those missing have not been found there
+    if (!gated)
+    {
+      for (const auto &tracked : _trackedMarkers)
+      {
+        bool found = false;
+        for (const auto &m : detectedMarkers)
+          if (m.id == tracked.id && m.dict_info == tracked.dict_info)
+            found = true;
+        if (!found)
+        {
+          fullScan = true;
+          break;
+        }
+      }
+    }
+    if (fullScan)
+      _candidates.clear();
+  }
+  if (fullScan)
+  {
+    detectInRegion(grey, grey.size(), detectedMarkers, thresholdImageReady);
+    Timer.add("Detect in image");
+  }
+
+  /*************************
+   * REMOVAL OF DUPLICATED *
+   *************************/
+
+  // sort by id
+  std::sort(detectedMarkers.begin(), detectedMarkers.end());
 
-  float ResizeFactor = 1;
+  // there might be still the case that a marker is detected twice because of the double border indicated earlier,
+  // (or because it lies in two regions of interest) detect and remove these cases.
+  // Since they are sorted, only the markers in the same run of ids need to be compared
+  std::vector<bool> &toRemove = ws.toRemove;
+  toRemove.assign(detectedMarkers.size(), false);
 
+  for (std::size_t first = 0, last = 0; first < detectedMarkers.size(); first = last)
+  {
+    while (last < detectedMarkers.size() && detectedMarkers[last].id == detectedMarkers[first].id)
+      last++;
+    for (std::size_t i = first; i + 1 < last; i++)
+    {
+      for (std::size_t j = i + 1; j < last && !toRemove[i]; j++)
+      {
+        if (detectedMarkers[i].dict_info == detectedMarkers[j].dict_info)
+        {
+          // deletes the one with smaller perimeter
+          if (perimeter(detectedMarkers[i]) < perimeter(detectedMarkers[j]))
+            toRemove[i] = true;
+          else
+            toRemove[j] = true;
+        }
+      }
+    }
+  }
+
+  removeElements(detectedMarkers, toRemove);
+  ws.mark(FrameStats::STAGE_CLASSIFICATION);
+  ws.stats.count[FrameStats::COUNT_MARKERS] = static_cast<int>(detectedMarkers.size());
+
+  /*************************
+  * MARKER POSE ESTIMATION *
+  **************************/
+  // detect the position of detected markers if desired
+  if (camMatrix.rows != 0 && markerSizeMeters > 0)
+  {
+    // converts the matrices only if they have changed since the previous frame
+    PreparedCamera &camera = ws.camera;
+    camera.prepare(camMatrix, distCoeff, extrinsics, input.size());
+    bool ippe = _params.poseMethod == POSE_IPPE && !correctFisheye;
+    bool refine = _params.poseRefinement;
+    threadPool().run(detectedMarkers.size(), [&](std::size_t i)
+    {
+      if (ippe)
+        detectedMarkers[i].calculateExtrinsicsIPPE(markerSizeMeters, camera, setYPerpendicular, refine);
+      else
+        detectedMarkers[i].calculateExtrinsics(markerSizeMeters, camera, setYPerpendicular, correctFisheye);
+    });
+    Timer.add("Pose Estimation");
+    ws.mark(FrameStats::STAGE_POSE);
+  }
+
+  // the markers kept by the motion gate have already their poses
+  if (!reused.empty())
+  {
+    detectedMarkers.insert(detectedMarkers.end(), reused.begin(), reused.end());
+    std::sort(detectedMarkers.begin(), detectedMarkers.end());
+  }
+  if (_params.motionGate)
+    updateMotionGate(detectedMarkers, gated ? &rois : nullptr);
+
+  // compute _markerMinSize
+  float mlength = std::numeric_limits<float>::max();
+  for (const auto &marker : detectedMarkers)
+  {
+    float l = 0;
+    for (int c = 0; c < 4; c++)
+      l += cv::norm(marker[c] - marker[(c + 1) % 4]);
+    if (mlength > l)
+      mlength = l;
+  }
+
+  float markerMinSize;
+  if (mlength != std::numeric_limits<float>::max())
+    markerMinSize = mlength / (4 * std::max(input.cols, input.rows));
+  else
+    markerMinSize = 0;
+  if (_params._autoSize)
+  {
+    _params.minSize = markerMinSize * (1 - _params._ts);
+  }
+
+  // keep track of the markers for the next frame
+  if (_detectMode == DM_TRACKING)
+  {
+    _trackedMarkers = detectedMarkers;
+    _framesSinceFullScan = fullScan ? 0 : _framesSinceFullScan + 1;
+  }
+
+  ws.stats.ms[FrameStats::STAGE_TOTAL] = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - frameStart).count();
+  std::lock_guard<std::mutex> lock(ws.statsMutex);
+  ws.stats.frame = ++ws.frames;
+  ws.statsHistory[(ws.stats.frame - 1) % frameStatsHistorySize] = ws.stats;
+}
+
+MarkerDetector::FrameStats MarkerDetector::getLastFrameStats() const
+{
+  std::lock_guard<std::mutex> lock(_workspace->statsMutex);
+  if (_workspace->frames == 0)
+    return FrameStats();
+  return _workspace->statsHistory[(_workspace->frames - 1) % frameStatsHistorySize];
+}
+
+std::vector<MarkerDetector::FrameStats> MarkerDetector::getFrameStatsHistory() const
+{
+  std::lock_guard<std::mutex> lock(_workspace->statsMutex);
+  uint64_t historySize = frameStatsHistorySize, frames = _workspace->frames;
+  std::vector<FrameStats> history;
+  for (uint64_t f = frames - std::min(frames, historySize); f < frames; f++)
+    history.push_back(_workspace->statsHistory[f % historySize]);
+  return history;
+}
+
+const char* MarkerDetector::FrameStats::stageName(int stage)
+{
+  static const char* names[NSTAGES] = {"convert_grey", "motion_gate", "resize", "pyramid", "threshold", "prefilter",
+                                       "classification", "corner_refinement", "pose", "total"};
+  return stage >= 0 && stage < NSTAGES ? names[stage] : "";
+}
+
+const char* MarkerDetector::FrameStats::countName(int count)
+{
+  static const char* names[NCOUNTS] = {"regions", "threshold_attempts", "rectangles", "candidates", "markers",
+                                       "gate_skipped", "gate_reused"};
+  return count >= 0 && count < NCOUNTS ? names[count] : "";
+}
+
+// bounding box of the corners of the marker, enlarged pad pixels in every direction
+static cv::Rect paddedBoundingRect(const Marker &m, int pad)
+{
+  float minX = m[0].x, maxX = m[0].x, minY = m[0].y, maxY = m[0].y;
+  for (int c = 1; c < 4; c++)
+  {
+    minX = std::min(minX, m[c].x);
+    maxX = std::max(maxX, m[c].x);
+    minY = std::min(minY, m[c].y);
+    maxY = std::max(maxY, m[c].y);
+  }
+  return cv::Rect(cv::Point(int(minX) - pad, int(minY) - pad), cv::Point(int(maxX) + 1 + pad, int(maxY) + 1 + pad));
+}
+
+// joins the overlapping regions so that no area is processed twice
+static void mergeOverlapping(std::vector<cv::Rect> &rois)
+{
+  bool merged = true;
+  while (merged)
+  {
+    merged = false;
+    for (std::size_t i = 0; i < rois.size() && !merged; i++)
+      for (std::size_t j = i + 1; j < rois.size() && !merged; j++)
+        if ((rois[i] & rois[j]).area() > 0)
+        {
+          rois[i] |= rois[j];
+          rois.erase(rois.begin() + j);
+          merged = true;
+        }
+  }
+}
+
+static int totalArea(const std::vector<cv::Rect> &rois)
+{
+  int area = 0;
+  for (const auto &roi : rois)
+    area += roi.area();
+  return area;
+}
+
+std::vector<cv::Rect> MarkerDetector::getTrackingROIs(cv::Size imageSize) const
+{
+  std::vector<cv::Rect> rois;
+  // full scan if nothing is being tracked or it is time to look for new markers
+  if (_trackedMarkers.empty() || _framesSinceFullScan + 1 >= _params.trackingFullScanInterval)
+    return rois;
+
+  cv::Rect imageRect(0, 0, imageSize.width, imageSize.height);
+  for (const auto &m : _trackedMarkers)
+  {
+    // bounding box of the marker enlarged proportionally to its side length
+    int pad = static_cast<int>(_params.trackingRoiPadding * m.getPerimeter() / 4.f) + 1;
+    cv::Rect roi = paddedBoundingRect(m, pad) & imageRect;
+    if (roi.area() > 0)
+      rois.push_back(roi);
+  }
+  mergeOverlapping(rois);
+
+  // not worth it if the regions cover most of the image
+  if (totalArea(rois) > imageRect.area() / 2)
+    rois.clear();
+  return rois;
+}
+
+bool MarkerDetector::getMotionGateROIs(const cv::Mat &grey, std::vector<cv::Rect>& rois, std::vector<Marker>& reused)
+{
+  Workspace &ws = *_workspace;
+  int blockSize = std::max(1, _params.motionGateBlockSize);
+  cv::Size blocks((grey.cols + blockSize - 1) / blockSize, (grey.rows + blockSize - 1) / blockSize);
+  // INTER_AREA gives the mean of the pixels each block covers
+  cv::resize(grey, ws.gateBlocks, blocks, 0, 0, cv::INTER_AREA);
+  if (ws.gateImageSize != grey.size() || ws.gateReference.size() != blocks
+      || ws.gateFramesSinceFull + 1 >= _params.motionGateRefreshInterval)
+    return false;
+
+  cv::absdiff(ws.gateBlocks, ws.gateReference, ws.gateDiff);
+  cv::threshold(ws.gateDiff, ws.gateMask, _params.motionGateThreshold, 255, cv::THRESH_BINARY);
+  int nchanged = cv::countNonZero(ws.gateMask);
+  if (2 * nchanged > blocks.area())
+    return false;
+
+  // each group of connected changed blocks, enlarged one block in every direction for the markers on its border
+  cv::Rect imageRect(0, 0, grey.cols, grey.rows);
+  std::vector<cv::Rect> &changed = ws.gateRegions;
+  changed.clear();
+  if (nchanged > 0)
+  {
+    cv::findContours(ws.gateMask, ws.gateContours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+    for (const auto &contour : ws.gateContours)
+    {
+      cv::Rect b = cv::boundingRect(contour);
+      cv::Point tl((b.x - 1) * grey.cols / blocks.width, (b.y - 1) * grey.rows / blocks.height);
+      cv::Point br(((b.x + b.width + 1) * grey.cols + blocks.width - 1) / blocks.width,
+                   ((b.y + b.height + 1) * grey.rows + blocks.height - 1) / blocks.height);
+      changed.push_back(cv::Rect(tl, br) & imageRect);
+    }
+    mergeOverlapping(changed);
+  }
+
+  // the previous markers touching a region must be detected again, so it is grown until it contains them whole
+  std::vector<bool> &inRegion = ws.gateInRegion;
+  inRegion.assign(ws.gateMarkers.size(), false);
+  bool grown = !changed.empty();
+  while (grown)
+  {
+    grown = false;
+    for (std::size_t i = 0; i < ws.gateMarkers.size(); i++)
+    {
+      if (inRegion[i])
+        continue;
+      cv::Rect markerRect = paddedBoundingRect(ws.gateMarkers[i], blockSize) & imageRect;
+      for (auto &region : changed)
+        if ((region & markerRect).area() > 0)
+        {
+          region |= markerRect;
+          inRegion[i] = true;
+          grown = true;
+          break;
+        }
+    }
+    if (grown)
+      mergeOverlapping(changed);
+  }
+
+  // not worth it if the regions cover most of the image
+  if (totalArea(changed) > imageRect.area() / 2)
+    return false;
+  rois.assign(changed.begin(), changed.end());
+  for (std::size_t i = 0; i < ws.gateMarkers.size(); i++)
+    if (!inRegion[i])
+      reused.push_back(ws.gateMarkers[i]);
+  return true;
+}
+
+void MarkerDetector::updateMotionGate(const std::vector<Marker>& detectedMarkers, const std::vector<cv::Rect>* rois)
+{
+  Workspace &ws = *_workspace;
+  if (rois == nullptr)
+  {
+    ws.gateBlocks.copyTo(ws.gateReference);
+    ws.gateImageSize = grey.size();
+    ws.gateFramesSinceFull = 0;
+  }
+  else
+  {
+    // only the blocks whole inside a region have been detected again
+    cv::Size blocks = ws.gateBlocks.size();
+    for (const auto &roi : *rois)
+    {
+      cv::Range x((roi.x * blocks.width + grey.cols - 1) / grey.cols, roi.br().x * blocks.width / grey.cols);
+      cv::Range y((roi.y * blocks.height + grey.rows - 1) / grey.rows, roi.br().y * blocks.height / grey.rows);
+      if (x.size() > 0 && y.size() > 0)
+      {
+        cv::Mat reference = ws.gateReference(y, x);
+        ws.gateBlocks(y, x).copyTo(reference);
+      }
+    }
+    ws.gateFramesSinceFull++;
+  }
+  ws.gateMarkers = detectedMarkers;
+}
+
+cv::Size MarkerDetector::getThresholdImageSize(cv::Size regionSize, cv::Size fullImageSize) const
+{
   // use the minimum and markerWarpSize to determine the optimal image size on which to do rectangle detection
-  cv::Mat imgToBeThresHolded;
-  cv::Size maxImageSize = grey.size();
-  auto minpixsize = getMinMarkerSizePix(input.size()); // min pixel size of the marker in the original image
+  cv::Size maxImageSize = regionSize;
+  auto minpixsize = getMinMarkerSizePix(fullImageSize); // min pixel size of the marker in the original image
   if (_params.lowResMarkerSize < minpixsize)
   {
-    ResizeFactor = float(_params.lowResMarkerSize) / float(minpixsize);
+    float ResizeFactor = float(_params.lowResMarkerSize) / float(minpixsize);
     if (ResizeFactor < 0.9)
     {
       // do not waste time if smaller than this
-      _debug_msg("Scale factor=" << ResizeFactor, 1);
-      maxImageSize.width = float(grey.cols) * ResizeFactor + 0.5;
-      maxImageSize.height = float(grey.rows) * ResizeFactor + 0.5;
+      maxImageSize.width = float(regionSize.width) * ResizeFactor + 0.5;
+      maxImageSize.height = float(regionSize.height) * ResizeFactor + 0.5;
       if (maxImageSize.width % 2 != 0)
         maxImageSize.width++;
       if (maxImageSize.height % 2 != 0)
         maxImageSize.height++;
-      cv::resize(grey, imgToBeThresHolded, maxImageSize, 0, 0, cv::INTER_NEAREST);
-//      cv::resize(grey, imgToBeThresHolded, maxImageSize, 0, 0, cv::INTER_LINEAR);
     }
   }
+  return maxImageSize;
+}
 
-  if (imgToBeThresHolded.empty()) // if not set in previous step, add original now
-    imgToBeThresHolded = grey;
-
-  Timer.add("CreateImageToTheshold");
-  bool needPyramid = true; // ResizeFactor < 1/_params.pyrfactor; // only use pyramid if working on a big image.
-  std::thread buildPyramidThread;
-  if (needPyramid)
+void MarkerDetector::convertToGreyAndDecimate(const cv::Mat &bgr, cv::Mat &grey, cv::Mat &decimated,
+                                              const std::vector<int> &xofs, const std::vector<int> &yofs,
+                                              ThreadPool &pool)
+{
+  const cv::Size decimatedSize(int(xofs.size()), int(yofs.size()));
+  grey.create(bgr.size(), CV_8UC1);
+  decimated.create(decimatedSize, CV_8UC1);
+
+  // the image is converted in bands of rows small enough to stay in the cache, from which the decimated rows are
+  // taken right after. The vectorized conversion of OpenCV is kept, it is called on each band
+  const int bandRows = 16;
+  const int nbands = (bgr.rows + bandRows - 1) / bandRows;
+  const int nthreads = std::max(1, std::min(pool.size() + 1, nbands));
+  auto convertBands = [&](std::size_t t)
   {
-    if (_params.maxThreads > 1)
-      buildPyramidThread = std::thread([&]
+    for (int b = int(t); b < nbands; b += nthreads)
+    {
+      int r0 = b * bandRows, r1 = std::min(r0 + bandRows, bgr.rows);
+      cv::Mat greyBand = grey.rowRange(r0, r1);
+      cv::cvtColor(bgr.rowRange(r0, r1), greyBand, cv::COLOR_BGR2GRAY);
+      for (auto y = std::lower_bound(yofs.begin(), yofs.end(), r0); y != yofs.end() && *y < r1; ++y)
       {
-        buildPyramid(imagePyramid, grey, 2 * getMarkerWarpSize());
-      });
-    else
-      buildPyramid(imagePyramid, grey, 2 * getMarkerWarpSize());
-    Timer.add("BuildPyramid");
-  }
+        const uchar *src = grey.ptr<uchar>(*y);
+        uchar *dst = decimated.ptr<uchar>(int(y - yofs.begin()));
+        for (int x = 0; x < decimatedSize.width; x++)
+          dst[x] = src[xofs[x]];
+      }
+    }
+  };
+  if (nthreads > 1)
+    pool.run(nthreads, convertBands);
   else
+    convertBands(0);
+}
+
+void MarkerDetector::detectInRegion(const cv::Mat& greyRegion, cv::Size fullImageSize,
+                                    std::vector<Marker>& detectedMarkers, bool thresholdImageReady)
+{
+  ScopedTimerEvents Timer("detectInRegion");
+
+  /*****************************************************************
+   * CREATE LOW RESOLUTION IMAGE IN WHICH MARKERS WILL BE DETECTED *
+   *****************************************************************/
+
+  Workspace &ws = *_workspace;
+  ws.stats.count[FrameStats::COUNT_REGIONS]++;
+  cv::Mat imgToBeThresHolded;
+  cv::Size maxImageSize = getThresholdImageSize(greyRegion.size(), fullImageSize);
+  if (maxImageSize != greyRegion.size())
   {
-    imagePyramid.resize(1);
-    imagePyramid[0] = grey;
+    _debug_msg("Scale factor=" << float(maxImageSize.width) / float(greyRegion.cols), 1);
+    // detect() may have done it while converting the image to grey
+    if (!thresholdImageReady || ws.imgToBeThresHolded.size() != maxImageSize)
+      cv::resize(greyRegion, ws.imgToBeThresHolded, maxImageSize, 0, 0, cv::INTER_NEAREST);
+    imgToBeThresHolded = ws.imgToBeThresHolded;
+//      cv::resize(greyRegion, imgToBeThresHolded, maxImageSize, 0, 0, cv::INTER_LINEAR);
   }
 
-  int nAttemptsAutoFix = 0;
+  if (imgToBeThresHolded.empty()) // if not set in previous step, add original now
+    imgToBeThresHolded = greyRegion;
+
+  Timer.add("CreateImageToTheshold");
+  ws.mark(FrameStats::STAGE_RESIZE);
+  bool needPyramid = true; // ResizeFactor < 1/_params.pyrfactor; // only use pyramid if working on a big image.
+  // only the sizes of the levels are set here. They are built when the first candidate read from them is found, so
+  // a frame without candidates does not compute any
+  resetPyramid(greyRegion, needPyramid ? 2 * getMarkerWarpSize() : greyRegion.cols);
+
   bool keepLookingFor = false;
-  std::vector<float> hist(256, 0);
+  std::vector<int> &retryThresholds = ws.retryThresholds;
+  retryThresholds.clear();
+  std::vector<float> &hist = ws.hist;
+  hist.assign(256, 0);
+  std::size_t firstCandidate = _candidates.size();
   do
   {
     /**************************************************
      * THRESHOLD IMAGES AND DETECT INITIAL RECTANGLES *
      **************************************************/
-    std::vector<MarkerCandidate> MarkerCanditates;
-    MarkerCanditates = thresholdAndDetectRectangles(imgToBeThresHolded);
+    CandidateCorners &MarkerCanditates = _candidateCorners;
+    thresholdAndDetectRectangles(imgToBeThresHolded, MarkerCanditates, retryThresholds);
     thres = _thres_Images[0];
 
     _debug_exec(10,
@@ -643,6 +1458,9 @@ void MarkerDetector::detect(const cv::Mat& input, std::vector<Marker>& detectedM
     );
 
     Timer.add("Threshold and Detect rectangles");
+    ws.mark(FrameStats::STAGE_THRESHOLD);
+    ws.stats.count[FrameStats::COUNT_THRESHOLD_ATTEMPTS]++;
+    ws.stats.count[FrameStats::COUNT_RECTANGLES] += static_cast<int>(MarkerCanditates.size() / 4);
 
     // prefilter candidates
     _debug_exec(10,
@@ -650,226 +1468,284 @@ void MarkerDetector::detect(const cv::Mat& input, std::vector<Marker>& detectedM
         // show the thresholded images
         cv::Mat imrect;
         cv::cvtColor(imgToBeThresHolded, imrect, cv::COLOR_GRAY2BGR);
-        for (auto m : MarkerCanditates)
-          m.draw(imrect, cv::Scalar(0, 245, 0));
+        for (std::size_t c = 0; c + 3 < MarkerCanditates.size(); c += 4)
+          Marker(CandidateCorners(MarkerCanditates.begin() + c, MarkerCanditates.begin() + c + 4)).draw(imrect, cv::Scalar(0, 245, 0));
         cv::imshow("rect-nofiltered", imrect);
     );
 
-    MarkerCanditates = prefilterCandidates(MarkerCanditates, imgToBeThresHolded.size());
+    prefilterCandidates(MarkerCanditates, imgToBeThresHolded.size());
 
     Timer.add("prefilterCandidates");
+    ws.mark(FrameStats::STAGE_PREFILTER);
+    ws.stats.count[FrameStats::COUNT_CANDIDATES] += static_cast<int>(MarkerCanditates.size() / 4);
 
     _debug_exec(10,
         // only executes when compiled in DEBUG mode if debug level is at least 10
         // show the thresholded images
         cv::Mat imrect;
         cv::cvtColor(imgToBeThresHolded, imrect, cv::COLOR_GRAY2BGR);
-        for (auto m : MarkerCanditates)
-          m.draw(imrect, cv::Scalar(0, 245, 0));
+        for (std::size_t c = 0; c + 3 < MarkerCanditates.size(); c += 4)
+          Marker(CandidateCorners(MarkerCanditates.begin() + c, MarkerCanditates.begin() + c + 4)).draw(imrect, cv::Scalar(0, 245, 0));
         cv::imshow("rect-filtered", imrect);
     );
 
-    // before going on, make sure the piramid is built
-    if (buildPyramidThread.joinable())
-      buildPyramidThread.join();
-
     /************************************************************************
      * CANDIDATE CLASSIFICATION: Decide which candidates are really markers *
      ************************************************************************/
     auto markerWarpSize = getMarkerWarpSize();
 
-    detectedMarkers.clear();
-    _candidates.clear();
+    std::size_t ndetected = 0;
+    _candidates.resize(firstCandidate);
     for (auto &b : hist)
       b = 0;
     float desiredarea = std::pow(static_cast<float>(markerWarpSize), 2.f);
-    for (std::size_t i = 0; i < MarkerCanditates.size(); i++)
+    const bool useCellSampling = _params.sampleCells && markerIdDetector->supportsCellSampling();
+    // the canonical images are created in parallel, and labeled afterwards all at once
+    const bool useBatch = !useCellSampling && markerIdDetector->supportsBatchDetection();
+    const std::size_t ncandidates = MarkerCanditates.size() / 4;
+    std::vector<CandidateLabel> &labels = ws.labels;
+    labels.resize(ncandidates);
+
+    // warping is one of the most time consuming operations, especially when the region is large. To reduce
+    // computing time, each candidate is read from the coarsest level of the image pyramid in which it is still
+    // bigger than the canonical marker. Only the levels up to the coarsest one needed are built, and the ones built
+    // in a previous attempt of THRES_AUTO_FIXED are kept
+    std::size_t maxPyramidLevel = 0;
+    for (std::size_t i = 0; i < ncandidates && needPyramid; i++)
     {
-      // Find projective homography
-      cv::Mat canonicalMarker, canonicalMarkerAux;
-
-      cv::Mat inToWarp = imgToBeThresHolded;
-      MarkerCandidate points2d_pyr = MarkerCanditates[i];
-      if (needPyramid)
+      float area = candidateArea(&MarkerCanditates[4 * i]);
+      std::size_t imgPyrIdx = 0;
+      for (std::size_t p = 1; p < imagePyramid.size(); p++)
       {
-        // warping is one of the most time consuming operations, especially when the region is large.
-        // To reduce computing time, let us find in the image pyramid, the best configuration to save time
-
-        // indicates how much bigger observation is wrt to desired patch
-        std::size_t imgPyrIdx = 0;
-        for (std::size_t p = 1; p < imagePyramid.size(); p++)
+        if (area / std::pow(4, p) >= desiredarea)
+          imgPyrIdx = p;
+        else
+          break;
+      }
+      labels[i].pyramidLevel = imgPyrIdx;
+      maxPyramidLevel = std::max(maxPyramidLevel, imgPyrIdx);
+    }
+    buildPyramidLevels(maxPyramidLevel);
+    Timer.add("BuildPyramid");
+    ws.mark(FrameStats::STAGE_PYRAMID);
+
+    // the candidates are distributed among the threads, each one with its own copy of the labeler and buffers. The
+    // labeler is not used by the threads in batch mode, so it need not be copied
+    ThreadPool &pool = threadPool();
+    int nthreads = std::max(1, std::min(pool.size() + 1, int(ncandidates / minCandidatesPerThread)));
+    if (!useBatch)
+      nthreads = prepareLabelerClones(nthreads);
+    std::vector<ClassificationScratch> &scratch = ws.scratch;
+    if (int(scratch.size()) < nthreads)
+      scratch.resize(nthreads);
+    if (useBatch)
+      ws.batchImages.resize(ncandidates);
+    // with an id filter, the threads stop classifying once every id has been found (bit i of found, for the id i)
+    const bool earlyExit = !_idFilter.empty() && _idFilter.size() <= 64 && !useBatch;
+    const uint64_t allFound = _idFilter.size() >= 64 ? ~uint64_t(0) : (uint64_t(1) << _idFilter.size()) - 1;
+    std::atomic<uint64_t> found(0);
+    auto classify = [&](std::size_t t)
+    {
+      MarkerLabeler &labeler = t == 0 || useBatch ? *markerIdDetector : *_labelerClones[t - 1];
+      ClassificationScratch &sc = scratch[t];
+      if (_params._thresMethod == THRES_AUTO_FIXED)
+        sc.hist.assign(256, 0);
+      for (std::size_t i = t; i < ncandidates; i += nthreads)
+      {
+        const cv::Point2f *corners = &MarkerCanditates[4 * i];
+        CandidateLabel &label = labels[i];
+        if (earlyExit && found.load(std::memory_order_relaxed) == allFound)
         {
-          if (MarkerCanditates[i].getArea() / std::pow(4, p) >= desiredarea)
-            imgPyrIdx = p;
-          else
-            break;
+          label.isMarker = false;
+          continue;
         }
-        inToWarp = imagePyramid[imgPyrIdx];
-
-        // move points to the image level p
-        float ratio = float(inToWarp.cols) / float(imgToBeThresHolded.cols);
-        for (auto& p : points2d_pyr)
-          p *= ratio; // 1. / std::pow(2, imgPyrIdx);
 
-      }
+        // Find projective homography
+        cv::Mat inToWarp = imgToBeThresHolded;
+        CandidateCorners &points2d_pyr = sc.points;
+        points2d_pyr.assign(corners, corners + 4);
+        if (needPyramid)
+        {
+          inToWarp = imagePyramid[label.pyramidLevel];
 
-      warp(inToWarp, canonicalMarker, cv::Size(markerWarpSize, markerWarpSize), points2d_pyr);
-      int id, nRotations;
-      double min, Max;
-      cv::minMaxIdx(canonicalMarker, &min, &Max);
-      canonicalMarker.copyTo(canonicalMarkerAux);
-      std::string additionalInfo;
+          // move points to the image level p
+          float ratio = float(inToWarp.cols) / float(imgToBeThresHolded.cols);
+          for (auto& p : points2d_pyr)
+            p *= ratio; // 1. / std::pow(2, imgPyrIdx);
 
-      _debug_exec(10,
-          // only executes when compiled in DEBUG mode if debug level is at least 10
-          // show the thresholded images
-          std::stringstream sstr; sstr << "test-" << i;
-          std::cout << "test" << i << std::endl;
-          cv::namedWindow(sstr.str(), cv::WINDOW_NORMAL);
-          cv::imshow(sstr.str(), canonicalMarkerAux);
-          cv::waitKey(0);
-      );
-
-      if (markerIdDetector->detect(canonicalMarkerAux, id, nRotations, additionalInfo))
-      {
-        detectedMarkers.push_back(MarkerCanditates[i]);
-        detectedMarkers.back().id = id;
-        detectedMarkers.back().dict_info = additionalInfo;
-
-        // sort the points so that they are always in the same order no matter the camera orientation
-        std::rotate(detectedMarkers.back().begin(), detectedMarkers.back().begin() + 4 - nRotations,
-                    detectedMarkers.back().end());
-        _debug_exec(10,
-            // only executes when compiled in DEBUG mode if debug level is at least 10
-            // show the thresholded images
-            std::stringstream sstr; sstr << "can-" << detectedMarkers.back().id;
-            cv::namedWindow(sstr.str(), cv::WINDOW_NORMAL);
-            cv::imshow(sstr.str(), canonicalMarker);
-            std::cout << "ID=" << id << " " << detectedMarkers.back() << std::endl;
-        );
-        if (_params._thresMethod == THRES_AUTO_FIXED)
-          addToImageHist(canonicalMarker, hist);
         }
-        else
-          _candidates.push_back(MarkerCanditates[i]);
+
+        if (useCellSampling)
+        {
+          // the cells are read from the image, no need to create the canonical image
+          sc.cellSampler.setCandidate(inToWarp, points2d_pyr.data());
+          label.isMarker = labeler.detectFromCells(sc.cellSampler, label.id, label.nRotations, label.additionalInfo);
         }
-        Timer.add("Marker classification");
-        if (detectedMarkers.size() == 0 && _params._thresMethod == THRES_AUTO_FIXED
-            && ++nAttemptsAutoFix < _params.NAttemptsAutoThresFix)
+        else if (useBatch)
         {
-          _params._ThresHold = 10 + rand() % 230;
-          keepLookingFor = true;
+          warp(inToWarp, ws.batchImages[i], cv::Size(markerWarpSize, markerWarpSize), points2d_pyr);
+          continue;
         }
         else
-          keepLookingFor = false;
-      } while (keepLookingFor);
-
-      if (_params._thresMethod == THRES_AUTO_FIXED)
-      {
-        int newThres = Otsu(hist);
-        if (newThres > 0)
-          _params._ThresHold = float(newThres);
-      }
-
-#ifdef debug_lines
-      cv::imshow("image-lines",image);
-      cv::waitKey(10);
-#endif
-
-      // now, move the points to the original image (upsample corners)
-      if (input.cols != imgToBeThresHolded.cols)
-      {
-        cornerUpsample(detectedMarkers, imgToBeThresHolded.size());
-        Timer.add("Corner Upsample");
-      }
-
-      /*********************************
-       * CORNER REFINEMENT IF REQUIRED *
-       *********************************/
-      // refine the corner location if enclosed markers and we did not do it via upsampling
-      if (detectedMarkers.size() > 0 /* &&_params.enclosedMarker */ && input.size() == imgToBeThresHolded.size())
-      {
-        int halfwsize = 2 * float(input.cols) / float(imgToBeThresHolded.cols) + 0.5;
-        std::vector<cv::Point2f> Corners;
-        for (unsigned int i = 0; i < detectedMarkers.size(); i++)
-          for (int c = 0; c < 4; c++)
-            Corners.push_back(detectedMarkers[i][c]);
-        cornerSubPix(grey, Corners, cv::Size(halfwsize, halfwsize), cv::Size(-1, -1),
-                     cv::TermCriteria(cv::TermCriteria::MAX_ITER | cv::TermCriteria::EPS, 12, 0.005));
-        // copy back
-        for (unsigned int i = 0; i < detectedMarkers.size(); i++)
-          for (int c = 0; c < 4; c++)
-            detectedMarkers[i][c] = Corners[i * 4 + c];
-        Timer.add("Corner Refinement");
-      }
-
-      /*************************
-       * REMOVAL OF DUPLICATED *
-       *************************/
-
-      // sort by id
-      std::sort(detectedMarkers.begin(), detectedMarkers.end());
-
-      // there might be still the case that a marker is detected twice because of the double border indicated earlier,
-      // detect and remove these cases
-      std::vector<bool> toRemove(detectedMarkers.size(), false);
+        {
+          warp(inToWarp, sc.canonicalMarker, cv::Size(markerWarpSize, markerWarpSize), points2d_pyr);
+          double min, Max;
+          cv::minMaxIdx(sc.canonicalMarker, &min, &Max);
+          sc.canonicalMarker.copyTo(sc.canonicalMarkerAux);
+
+          _debug_exec(10,
+              // only executes when compiled in DEBUG mode if debug level is at least 10
+              // show the thresholded images
+              std::stringstream sstr; sstr << "test-" << i;
+              std::cout << "test" << i << std::endl;
+              cv::namedWindow(sstr.str(), cv::WINDOW_NORMAL);
+              cv::imshow(sstr.str(), sc.canonicalMarkerAux);
+              cv::waitKey(0);
+          );
+          label.isMarker = labeler.detect(sc.canonicalMarkerAux, label.id, label.nRotations, label.additionalInfo);
+        }
 
-      for (int i = 0; i < int(detectedMarkers.size()) - 1; i++)
-      {
-        for (int j = i + 1; j < int(detectedMarkers.size()) && !toRemove[i]; j++)
+        if (label.isMarker && !_idFilter.empty())
+        {
+          int index = _idFilter.index(label.id, label.additionalInfo);
+          if (index == -1)
+            label.isMarker = false;
+          else if (earlyExit)
+            found.fetch_or(uint64_t(1) << index, std::memory_order_relaxed);
+        }
+        if (label.isMarker)
         {
-          if (detectedMarkers[i].id == detectedMarkers[j].id
-              && detectedMarkers[i].dict_info == detectedMarkers[j].dict_info)
+          _debug_exec(10,
+              // only executes when compiled in DEBUG mode if debug level is at least 10
+              // show the thresholded images
+              if (!useCellSampling)
+              {
+                std::stringstream sstr; sstr << "can-" << label.id;
+                cv::namedWindow(sstr.str(), cv::WINDOW_NORMAL);
+                cv::imshow(sstr.str(), sc.canonicalMarker);
+              }
+          );
+          if (_params._thresMethod == THRES_AUTO_FIXED)
           {
-            // deletes the one with smaller perimeter
-            if (perimeter(detectedMarkers[i]) < perimeter(detectedMarkers[j]))
-              toRemove[i] = true;
+            if (useCellSampling)
+              sc.cellSampler.addToHistogram(sc.hist);
             else
-              toRemove[j] = true;
+              addToImageHist(sc.canonicalMarker, sc.hist);
           }
         }
       }
+    };
+    if (nthreads > 1)
+      pool.run(nthreads, classify);
+    else
+      classify(0);
 
-      removeElements(detectedMarkers, toRemove);
-
-      /*************************
-      * MARKER POSE ESTIMATION *
-      **************************/
-      // detect the position of detected markers if desired
-      if (camMatrix.rows != 0 && markerSizeMeters > 0)
+    if (useBatch)
+    {
+      std::vector<MarkerLabeler::Label> &batchLabels = ws.batchLabels;
+      markerIdDetector->detectBatch(ws.batchImages, batchLabels);
+      for (std::size_t i = 0; i < ncandidates; i++)
       {
-        for (unsigned int i = 0; i < detectedMarkers.size(); i++)
-          detectedMarkers[i].calculateExtrinsics(markerSizeMeters, camMatrix, distCoeff, extrinsics, setYPerpendicular, correctFisheye);
-        Timer.add("Pose Estimation");
+        CandidateLabel &label = labels[i];
+        label.isMarker = batchLabels[i].isMarker && _idFilter.accepts(batchLabels[i].id, batchLabels[i].additionalInfo);
+        label.id = batchLabels[i].id;
+        label.nRotations = batchLabels[i].nRotations;
+        label.additionalInfo = batchLabels[i].additionalInfo;
+        if (label.isMarker && _params._thresMethod == THRES_AUTO_FIXED)
+          addToImageHist(ws.batchImages[i], scratch[0].hist);
       }
+    }
 
-      // compute _markerMinSize
-      float mlength = std::numeric_limits<float>::max();
-      for (const auto &marker : detectedMarkers)
+    // merge in the order of the candidates, so that the result does not depend on the number of threads
+    for (std::size_t i = 0; i < ncandidates; i++)
+    {
+      const cv::Point2f *corners = &MarkerCanditates[4 * i];
+      const CandidateLabel &label = labels[i];
+      if (label.isMarker)
       {
-        float l = 0;
-        for (int c = 0; c < 4; c++)
-          l += cv::norm(marker[c] - marker[(c + 1) % 4]);
-        if (mlength > l)
-          mlength = l;
-      }
+        // the same as Marker(corners, id), but reusing the marker that was there
+        Marker &marker = reuseElement(detectedMarkers, ndetected++);
+        marker.assign(corners, corners + 4);
+        marker.id = label.id;
+        marker.ssize = -1;
+        marker.Rvec.create(3, 1, CV_32FC1);
+        marker.Tvec.create(3, 1, CV_32FC1);
+        marker.Rvec.setTo(-999999);
+        marker.Tvec.setTo(-999999);
+        // the marker may be reused from a previous frame, the second pose of IPPE must not survive
+        marker.poseErrorRatio = 0;
+        marker.Rvec2.release();
+        marker.Tvec2.release();
+        marker.dict_info = label.additionalInfo;
 
-      float markerMinSize;
-      if (mlength != std::numeric_limits<float>::max())
-        markerMinSize = mlength / (4 * std::max(input.cols, input.rows));
-      else
-        markerMinSize = 0;
-      if (_params._autoSize)
-      {
-        _params.minSize = markerMinSize * (1 - _params._ts);
+        // sort the points so that they are always in the same order no matter the camera orientation
+        std::rotate(marker.begin(), marker.begin() + 4 - label.nRotations, marker.end());
+        _debug_msg("ID=" << label.id << " " << marker, 10);
       }
+      else
+        _candidates.insert(_candidates.end(), corners, corners + 4);
+    }
+    detectedMarkers.resize(ndetected);
+    if (_params._thresMethod == THRES_AUTO_FIXED)
+      for (auto &sc : scratch)
+        for (std::size_t v = 0; v < hist.size(); v++)
+          hist[v] += sc.hist[v];
+    Timer.add("Marker classification");
+    ws.mark(FrameStats::STAGE_CLASSIFICATION);
+    // with a fixed threshold, if nothing is found the rest of the levels are all tried at once, in the workers, and the
+    // markers found in any of them are kept. The threshold of the next frame is then given by Otsu below
+    keepLookingFor = false;
+    if (detectedMarkers.size() == 0 && _params._thresMethod == THRES_AUTO_FIXED && retryThresholds.empty())
+    {
+      spreadThresholds(imgToBeThresHolded, _params.NAttemptsAutoThresFix - 1, _params._ThresHold, retryThresholds);
+      keepLookingFor = !retryThresholds.empty();
+    }
+  } while (keepLookingFor);
+
+  if (_params._thresMethod == THRES_AUTO_FIXED)
+  {
+    int newThres = Otsu(hist);
+    if (newThres > 0)
+      _params._ThresHold = float(newThres);
+  }
+
+#ifdef debug_lines
+  cv::imshow("image-lines",image);
+  cv::waitKey(10);
+#endif
+
+  // the budget of the corner refinement starts here
+  auto refinementDeadline = std::chrono::steady_clock::now()
+      + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double, std::milli>(_params.cornerRefinementBudgetMs));
+
+  // now, move the points to the original image (upsample corners)
+  if (greyRegion.cols != imgToBeThresHolded.cols)
+  {
+    cornerUpsample(detectedMarkers, imgToBeThresHolded.size(), refinementDeadline);
+    Timer.add("Corner Upsample");
+    ws.mark(FrameStats::STAGE_CORNER_REFINEMENT);
+  }
+
+  /*********************************
+   * CORNER REFINEMENT IF REQUIRED *
+   *********************************/
+  // refine the corner location if enclosed markers and we did not do it via upsampling
+  if (detectedMarkers.size() > 0 /* &&_params.enclosedMarker */ && greyRegion.size() == imgToBeThresHolded.size())
+  {
+    int halfwsize = 2 * float(greyRegion.cols) / float(imgToBeThresHolded.cols) + 0.5;
+    refineCorners(detectedMarkers, greyRegion, 1, halfwsize,
+                  cv::TermCriteria(cv::TermCriteria::MAX_ITER | cv::TermCriteria::EPS, 12, 0.005), refinementDeadline);
+    Timer.add("Corner Refinement");
+    ws.mark(FrameStats::STAGE_CORNER_REFINEMENT);
+  }
 }
 
 /**
  * Expands the corners of the candidate to reach the real locations
  * Used in eroded images
  */
-void MarkerDetector::enlargeMarkerCandidate(MarkerCandidate &cand, int fact)
+void MarkerDetector::enlargeMarkerCandidate(cv::Point2f *cand, int fact)
 {
   for (int j = 0; j < 2; j++)
   {
@@ -995,11 +1871,16 @@ bool MarkerDetector::warp(cv::Mat& in, cv::Mat& out, cv::Size size, std::vector<
  *
  */
 int MarkerDetector::perimeter(const std::vector<cv::Point2f>& a)
+{
+  return perimeter(a.data(), a.size());
+}
+
+int MarkerDetector::perimeter(const cv::Point2f *a, std::size_t n)
 {
   int sum = 0;
-  for (unsigned int i = 0; i < a.size(); i++)
+  for (std::size_t i = 0; i < n; i++)
   {
-    int i2 = (i + 1) % a.size();
+    std::size_t i2 = (i + 1) % n;
     sum += static_cast<int>(std::sqrt(
         (a[i].x - a[i2].x) * (a[i].x - a[i2].x) + (a[i].y - a[i2].y) * (a[i].y - a[i2].y)));
   }
@@ -1087,12 +1968,44 @@ cv::Point2f MarkerDetector::getCrossPoint(const cv::Point3f& line1, const cv::Po
   return cv::Point2f(X.at<float>(0, 0), X.at<float>(1, 0));
 }
 
-void MarkerDetector::cornerUpsample(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize)
+void MarkerDetector::cornerUpsample(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize,
+                                    std::chrono::steady_clock::time_point deadline)
 {
-  cornerUpsample_SUBP(MarkerCanditates, lowResImageSize);
+  cornerUpsample_SUBP(MarkerCanditates, lowResImageSize, deadline);
 }
 
-void MarkerDetector::cornerUpsample_SUBP(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize)
+void MarkerDetector::refineCorners(std::vector<Marker>& markers, const cv::Mat &image, float scale, int halfwsize,
+                                   const cv::TermCriteria &criteria, std::chrono::steady_clock::time_point deadline)
+{
+  // cornerSubPix only reads a window around each corner, so the markers are refined independently. They are
+  // distributed among the threads the same way the candidates are classified
+  ThreadPool &pool = threadPool();
+  const std::size_t nmarkers = markers.size();
+  const int nthreads = std::max(1, std::min(pool.size() + 1, int(nmarkers / minMarkersPerThread)));
+  const bool budget = _params.cornerRefinementBudgetMs > 0;
+  auto refine = [&](std::size_t t)
+  {
+    for (std::size_t i = t; i < nmarkers; i += nthreads)
+    {
+      Marker &m = markers[i];
+      if (scale != 1)
+        for (auto &point : m)
+          point *= scale;
+      if ((_skipCornerRefinement && _skipCornerRefinement(m.id))
+          || (budget && std::chrono::steady_clock::now() > deadline))
+        continue;
+      cv::cornerSubPix(image, static_cast<std::vector<cv::Point2f>&>(m), cv::Size(halfwsize, halfwsize),
+                       cv::Size(-1, -1), criteria);
+    }
+  };
+  if (nthreads > 1)
+    pool.run(nthreads, refine);
+  else
+    refine(0);
+}
+
+void MarkerDetector::cornerUpsample_SUBP(std::vector<Marker>& MarkerCanditates, cv::Size lowResImageSize,
+                                         std::chrono::steady_clock::time_point deadline)
 {
   if (MarkerCanditates.size() == 0)
     return;
@@ -1106,6 +2019,8 @@ void MarkerDetector::cornerUpsample_SUBP(std::vector<Marker>& MarkerCanditates,
     else
       break;
   }
+  // the levels the candidates were read from are usually coarser, the finer ones are built now
+  buildPyramidLevels(startPyrImg);
 
 //#define _aruco_marker_detector_fast
 
@@ -1114,30 +2029,10 @@ void MarkerDetector::cornerUpsample_SUBP(std::vector<Marker>& MarkerCanditates,
   {
     float factor = float(imagePyramid[curpyr].cols) / float(prevLowResSize.width);
 
-    // upsample corner locations
-    for (auto &m : MarkerCanditates)
-      for (auto &point : m)
-      {
-        point *= factor;
-      }
-
+    // upsample corner locations, and refine them in this level
     int halfwsize = 0.5 + 2.5 * factor;
-    std::vector<cv::Point2f> p2d;
-    p2d.reserve(MarkerCanditates.size() * 4);
-    for (auto &m : MarkerCanditates)
-      for (auto &point : m)
-      {
-        p2d.push_back(point);
-      }
-
-    cv::cornerSubPix(imagePyramid[curpyr], p2d, cv::Size(halfwsize, halfwsize), cv::Size(-1, -1),
-                     cv::TermCriteria(cv::TermCriteria::MAX_ITER, 4, 0.5));
-    int cidx = 0;
-    for (auto &m : MarkerCanditates)
-      for (auto &point : m)
-      {
-        point = p2d[cidx++];
-      }
+    refineCorners(MarkerCanditates, imagePyramid[curpyr], factor, halfwsize,
+                  cv::TermCriteria(cv::TermCriteria::MAX_ITER, 4, 0.5), deadline);
 
     prevLowResSize = imagePyramid[curpyr].size();
   }
@@ -1196,16 +2091,47 @@ void MarkerDetector::draw(cv::Mat out, const std::vector<Marker>& markers)
 void MarkerDetector::setMarkerLabeler(cv::Ptr<MarkerLabeler> detector)
 {
   markerIdDetector = detector;
+  if (!_idFilter.empty())
+    markerIdDetector->setIdFilter(_idFilter);
+  _labelerClones.clear();
 }
 
 void MarkerDetector::setDictionary(int dict_type, float error_correction_rate)
 {
-  markerIdDetector = MarkerLabeler::create((Dictionary::DICT_TYPES)dict_type, error_correction_rate);
+  setMarkerLabeler(MarkerLabeler::create((Dictionary::DICT_TYPES)dict_type, error_correction_rate));
 }
 
 void MarkerDetector::setDictionary(std::string dict_type, float error_correction_rate)
 {
-  markerIdDetector = MarkerLabeler::create(dict_type, std::to_string(error_correction_rate));
+  setMarkerLabeler(MarkerLabeler::create(dict_type, std::to_string(error_correction_rate)));
+}
+
+void MarkerDetector::setMarkerIdFilter(const MarkerIdFilter &filter)
+{
+  _idFilter = filter;
+  markerIdDetector->setIdFilter(_idFilter);
+  // the clones are made again with the filter
+  _labelerClones.clear();
+}
+
+int MarkerDetector::prepareLabelerClones(int nthreads)
+{
+  while (int(_labelerClones.size()) < nthreads - 1)
+  {
+    cv::Ptr<MarkerLabeler> clone = markerIdDetector->clone();
+    if (clone.empty())
+      break; // the labeler can only be used by one thread
+    _labelerClones.push_back(clone);
+  }
+  return std::min(nthreads, int(_labelerClones.size()) + 1);
+}
+
+std::vector<std::vector<cv::Point2f>> MarkerDetector::getCandidates() const
+{
+  std::vector<std::vector<cv::Point2f>> candidates;
+  for (std::size_t i = 0; i + 3 < _candidates.size(); i += 4)
+    candidates.push_back(std::vector<cv::Point2f>(_candidates.begin() + i, _candidates.begin() + i + 4));
+  return candidates;
 }
 
 cv::Mat MarkerDetector::getThresholdedImage(std::uint32_t idx)
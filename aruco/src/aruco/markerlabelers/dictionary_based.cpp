@@ -51,9 +51,7 @@ void DictionaryBased::setParams(const Dictionary& dic, float max_correction_rate
   }
   else
     vdic.push_back(dic);
-
-  for (auto &dic2 : vdic)
-    nbits_dict[dic2.nbits()].push_back(&dic2);
+  groupDictionaries();
 
   _max_correction_rate = std::max(0.f, std::min(1.0f, max_correction_rate));
 }
@@ -63,6 +61,28 @@ std::string DictionaryBased::getName() const
   return dicttypename;
 }
 
+cv::Ptr<MarkerLabeler> DictionaryBased::clone() const
+{
+  cv::Ptr<DictionaryBased> copy = cv::makePtr<DictionaryBased>(*this);
+  // make the groups point to the dictionaries of the copy
+  copy->groupDictionaries();
+  return copy;
+}
+
+void DictionaryBased::setIdFilter(const MarkerIdFilter& filter)
+{
+  _idFilter = filter;
+  groupDictionaries();
+}
+
+void DictionaryBased::groupDictionaries()
+{
+  nbits_dict.clear();
+  for (auto &dic : vdic)
+    if (_idFilter.acceptsDictionary(dic.getName()))
+      nbits_dict[dic.nbits()].push_back(&dic);
+}
+
 void DictionaryBased::toMat(uint64_t code, int nbits_sq, cv::Mat& out)
 {
   out.create(nbits_sq, nbits_sq, CV_8UC1);
@@ -76,11 +96,6 @@ void DictionaryBased::toMat(uint64_t code, int nbits_sq, cv::Mat& out)
   }
 }
 
-int hamm_distance(uint64_t a, uint64_t b)
-{
-  return static_cast<int>(std::bitset<64>(a ^ b).count());
-}
-
 bool DictionaryBased::detect(const cv::Mat& in, int& marker_id, int& nRotations, std::string &additionalInfo)
 {
   assert(in.rows == in.cols);
@@ -94,105 +109,151 @@ bool DictionaryBased::detect(const cv::Mat& in, int& marker_id, int& nRotations,
   // threshold image
   cv::threshold(grey, grey, 125, 255, cv::THRESH_BINARY | cv::THRESH_OTSU);
 
-  std::map<uint32_t, std::vector<uint64_t> > nbits_ids;
+  // for each group of dictionaries with the same number of bits, in increasing order
+  uint64_t ids[4];
+  for (auto &bitsids : nbits_dict)
+  {
+    if (getInnerCode(grey, bitsids.first, ids) && ids[0] != 0)
+      if (identify(bitsids.second, ids, marker_id, nRotations, additionalInfo))
+        return true;
+  }
+  return false;
+}
 
-  // for each
+bool DictionaryBased::detectFromCells(MarkerCellSampler& sampler, int& marker_id, int& nRotations,
+                                      std::string &additionalInfo)
+{
+  uchar cells[MaxCells];
+  uint64_t ids[4];
   for (auto &bitsids : nbits_dict)
   {
-    int nbits = bitsids.first;
-    std::vector<uint64_t> ids;
-    getInnerCode(grey, nbits, ids);
-    if (ids.size() > 0)
+    int bits_withborder = static_cast<int>(std::sqrt(bitsids.first)) + 2;
+    sampler.getCells(bits_withborder, cells);
+    if (getCodes(cells, bits_withborder, ids) && ids[0] != 0)
+      if (identify(bitsids.second, ids, marker_id, nRotations, additionalInfo))
+        return true;
+  }
+  return false;
+}
+
+bool DictionaryBased::identify(const std::vector<Dictionary*>& dicts, const uint64_t ids[4], int& marker_id,
+                               int& nRotations, std::string &additionalInfo)
+{
+  // check in every dictionary
+  for (auto &dic : dicts)
+  {
+    // try a perfect match
+    for (int rot = 0; rot < 4; rot++)
     {
-      if (ids[0] != 0)
+      int id = dic->find(ids[rot]);
+      // the marker is identified even if its id is not accepted, so it is discarded without looking further
+      if (id != -1 && !_idFilter.accepts(id, dic->getName()))
+        return false;
+      if (id != -1)
       {
-        nbits_ids[nbits] = ids;
+        nRotations = rot; // how many rotations are and its id
+        marker_id = id;
+        additionalInfo = dic->getName();
+        return true;
       }
     }
-  }
-
-  // how many are there?
-  if (nbits_ids.size() == 0)
-    return false;
 
-  // check if any dictionary recognizes it
-  for (auto nbits : nbits_ids)
-  {
-    const auto &ids = nbits.second;
-
-    // check in every dictionary
-    for (auto &dic : nbits_dict[nbits.first])
+    // try with some error/correction if allowed
+    if (_max_correction_rate > 0)
     {
-      // try a perfect match
-      for (int rot = 0; rot < 4; rot++)
-        if (dic->is(ids[rot]))
-        {
-//          std::cout << "MATCH:" << dic->getName() << " " << ids[rot] << std::endl;
-          nRotations = rot; // how many rotations are and its id
-          marker_id = dic->at(ids[rot]);
-          additionalInfo = dic->getName();
-          return true;
-        }
-
-      // try with some error/correction if allowed
-      if (_max_correction_rate > 0)
+      // find distance to map elements
+      int _maxCorrectionAllowed = static_cast<int>(static_cast<float>(dic->tau()) * _max_correction_rate);
+      if (_maxCorrectionAllowed <= 0)
+        continue;
+      // the lowest code of the dictionary close enough to any of the rotations wins, as when scanning the whole map
+      bool found = false;
+      uint64_t best_code = 0;
+      for (int i = 0; i < 4; i++)
       {
-        // find distance to map elements
-        int _maxCorrectionAllowed = static_cast<int>(static_cast<float>(dic->tau()) * _max_correction_rate);
-        for (auto ci : dic->getMapCode())
+        uint64_t code;
+        int id;
+        if (dic->findNearest(ids[i], _maxCorrectionAllowed - 1, code, id) && (!found || code < best_code))
         {
-          for (int i = 0; i < 4; i++)
-          {
-            if (hamm_distance(ci.first, ids[i]) < _maxCorrectionAllowed)
-            {
-              marker_id = ci.second;
-              nRotations = i;
-              additionalInfo = dic->getName();
-              return true;
-            }
-          }
+          found = true;
+          best_code = code;
+          marker_id = id;
+          nRotations = i;
         }
       }
+      if (found && !_idFilter.accepts(marker_id, dic->getName()))
+        return false;
+      if (found)
+      {
+        additionalInfo = dic->getName();
+        return true;
+      }
     }
   }
 
   return false;
 }
 
-bool DictionaryBased::getInnerCode(const cv::Mat& thres_img, int total_nbits, std::vector<uint64_t>& ids)
+void DictionaryBased::updateCellTables(int rows, int cols, int bits_withborder)
+{
+  if (_lutRows == rows && _lutCols == cols && _lutDivisions == bits_withborder)
+    return;
+  _lutRows = rows;
+  _lutCols = cols;
+  _lutDivisions = bits_withborder;
+  // same assignment of pixels to cells as int(float(bits_withborder) * float(x) / float(size))
+  _rowCell.resize(rows);
+  for (int y = 0; y < rows; y++)
+    _rowCell[y] = static_cast<uchar>(float(bits_withborder) * float(y) / float(rows));
+  _colCellStart.assign(bits_withborder + 1, cols);
+  for (int x = cols - 1; x >= 0; x--)
+    _colCellStart[static_cast<int>(float(bits_withborder) * float(x) / float(cols))] = x;
+  // empty cells (images smaller than the number of divisions) start where the next one does
+  for (int c = bits_withborder - 1; c >= 0; c--)
+    _colCellStart[c] = std::min(_colCellStart[c], _colCellStart[c + 1]);
+  _rowCellCount.assign(bits_withborder, 0);
+  for (int y = 0; y < rows; y++)
+    _rowCellCount[_rowCell[y]]++;
+}
+
+bool DictionaryBased::getInnerCode(const cv::Mat& thres_img, int total_nbits, uint64_t ids[4])
 {
   int bits_noborder = static_cast<int>(std::sqrt(total_nbits));
   int bits_withborder = bits_noborder + 2;
+  if (bits_withborder * bits_withborder > MaxCells)
+    return false;
 
   // Markers  are divided in (bits_a + 2)x(bits_a + 2) regions, of which the inner bits_axbits_a belongs to marker info
   // the external border should be entirely black
-  cv::Mat nonZeros(bits_withborder, bits_withborder, CV_32SC1);
-  cv::Mat nValues(bits_withborder, bits_withborder, CV_32SC1);
-  nonZeros.setTo(cv::Scalar::all(0));
-  nValues.setTo(cv::Scalar::all(0));
+  updateCellTables(thres_img.rows, thres_img.cols, bits_withborder);
+  int nonZeros[MaxCells] = {0};
   for (int y = 0; y < thres_img.rows; y++)
   {
     const uchar *ptr = thres_img.ptr<uchar>(y);
-    int my = float(bits_withborder) * float(y) / float(thres_img.rows);
-    for (int x = 0; x < thres_img.cols; x++)
+    int *rowNonZeros = nonZeros + _rowCell[y] * bits_withborder;
+    // each cell of the row is a contiguous run of pixels, this loop is vectorized by the compiler
+    for (int mx = 0; mx < bits_withborder; mx++)
     {
-      int mx = float(bits_withborder) * float(x) / float(thres_img.cols);
-      if (ptr[x] > 125)
-        nonZeros.at<int>(my, mx)++;
-      nValues.at<int>(my, mx)++;
+      int n = 0;
+      for (int x = _colCellStart[mx]; x < _colCellStart[mx + 1]; x++)
+        n += ptr[x] > 125;
+      rowNonZeros[mx] += n;
     }
   }
-  cv::Mat binaryCode(bits_withborder, bits_withborder, CV_8UC1);
 
   // now, make the threshold
+  uchar binaryCode[MaxCells];
   for (int y = 0; y < bits_withborder; y++)
     for (int x = 0; x < bits_withborder; x++)
     {
-      if (nonZeros.at<int>(y, x) > nValues.at<int>(y, x) / 2)
-        binaryCode.at<uchar>(y, x) = 1;
-      else
-        binaryCode.at<uchar>(y, x) = 0;
+      int nValues = _rowCellCount[y] * (_colCellStart[x + 1] - _colCellStart[x]);
+      binaryCode[y * bits_withborder + x] = nonZeros[y * bits_withborder + x] > nValues / 2;
     }
+  return getCodes(binaryCode, bits_withborder, ids);
+}
+
+bool DictionaryBased::getCodes(const uchar* binaryCode, int bits_withborder, uint64_t ids[4])
+{
+  int n = bits_withborder - 2;
 
   // check if border is completely black
   for (int y = 0; y < bits_withborder; y++)
@@ -201,25 +262,27 @@ bool DictionaryBased::getInnerCode(const cv::Mat& thres_img, int total_nbits, st
     if (y == 0 || y == bits_withborder - 1)
       inc = 1; // for first and last row, check the whole border
     for (int x = 0; x < bits_withborder; x += inc)
-      if (binaryCode.at<uchar>(y, x) != 0)
+      if (binaryCode[y * bits_withborder + x] != 0)
         return false;
   }
 
-  // take the inner code
-
-  cv::Mat _bits(bits_noborder, bits_noborder, CV_8UC1);
-  for (int y = 0; y < bits_noborder; y++)
-    for (int x = 0; x < bits_noborder; x++)
-      _bits.at<uchar>(y, x) = binaryCode.at<uchar>(y + 1, x + 1);
-
-  // now, get the 64bits ids
-  int nr = 0;
-  do
+  // now, get the 64bits ids of the inner code and its rotations. The last bit of the matrix (row major order) is
+  // the less significant one. Each rotation moves the bit (y,x) to (x,n-1-y)
+  auto bit = [n](int y, int x)
+  { return uint64_t(1) << ((n - 1 - y) * n + (n - 1 - x));};
+  ids[0] = ids[1] = ids[2] = ids[3] = 0;
+  for (int y = 0; y < n; y++)
   {
-    ids.push_back(touulong(_bits));
-    _bits = rotate(_bits);
-    nr++;
-  } while (nr < 4);
+    const uchar *row = binaryCode + (y + 1) * bits_withborder + 1;
+    for (int x = 0; x < n; x++)
+      if (row[x])
+      {
+        ids[0] |= bit(y, x);
+        ids[1] |= bit(x, n - 1 - y);
+        ids[2] |= bit(n - 1 - y, n - 1 - x);
+        ids[3] |= bit(n - 1 - x, y);
+      }
+  }
   return true;
 }
 
@@ -277,29 +340,4 @@ bool DictionaryBased::getInnerCode(const cv::Mat& thres_img, int total_nbits, st
 //  return true;
 //}
 
-// convert matrix of (0, 1)s in a 64 bit value
-uint64_t DictionaryBased::touulong(const cv::Mat& code)
-{
-  std::bitset<64> bits;
-  int bidx = 0;
-  for (int y = code.rows - 1; y >= 0; y--)
-    for (int x = code.cols - 1; x >= 0; x--)
-      bits[bidx++] = code.at<uchar>(y, x);
-  return bits.to_ullong();
-}
-
-cv::Mat DictionaryBased::rotate(const cv::Mat& in)
-{
-  cv::Mat out;
-  in.copyTo(out);
-  for (int i = 0; i < in.rows; i++)
-  {
-    for (int j = 0; j < in.cols; j++)
-    {
-      out.at<uchar>(i, j) = in.at<uchar>(in.cols - j - 1, i);
-    }
-  }
-  return out;
-}
-
 } // namespace aruco
@@ -52,24 +52,50 @@ public:
   // main virtual class to o detection
   bool detect(const cv::Mat& in, int& marker_id, int& nRotations, std::string &additionalInfo);
 
+  // detection from the cells sampled by the detector, no canonical image is needed
+  bool detectFromCells(MarkerCellSampler& sampler, int& marker_id, int& nRotations, std::string &additionalInfo);
+  bool supportsCellSampling() const
+  {
+    return true;
+  }
+
+  // codes of other ids are discarded once read, and the dictionaries without accepted ids are not searched
+  void setIdFilter(const MarkerIdFilter& filter);
+
   // returns the dictionary name
   std::string getName() const;
 
+  // the copy shares the dictionary tables, only the buffers are duplicated
+  cv::Ptr<MarkerLabeler> clone() const;
+
   int getNSubdivisions() const
   {
     return _nsubdivisions;
   }
 
 private:
-  bool getInnerCode(const cv::Mat& thres_img, int total_nbits, std::vector<uint64_t>& ids);
-  cv::Mat rotate(const cv::Mat& in);
-  uint64_t touulong(const cv::Mat& code);
+  // maximum number of cells (border included) of the supported markers, whose codes have up to 64 bits
+  static const int MaxCells = 10 * 10;
+  bool getInnerCode(const cv::Mat& thres_img, int total_nbits, uint64_t ids[4]);
+  // from the cells (border included, row major order), the codes of the four rotations
+  bool getCodes(const uchar* binaryCode, int bits_withborder, uint64_t ids[4]);
+  // groups by number of bits the dictionaries of vdic in which some id is accepted
+  void groupDictionaries();
+  // looks for the codes in the dictionaries, only the ids accepted by _idFilter
+  bool identify(const std::vector<Dictionary*>& dicts, const uint64_t ids[4], int& marker_id, int& nRotations,
+                std::string &additionalInfo);
+  // cell of each row and first column of each cell for the last size of canonical image
+  void updateCellTables(int rows, int cols, int bits_withborder);
+  std::vector<uchar> _rowCell;
+  std::vector<int> _rowCellCount, _colCellStart;
+  int _lutRows = 0, _lutCols = 0, _lutDivisions = 0;
   std::vector<Dictionary> vdic;
   void toMat(uint64_t code, int nbits_sq, cv::Mat& out);
   int _nsubdivisions = 0;
   float _max_correction_rate;
   std::string dicttypename;
   std::map<uint32_t, std::vector<Dictionary*>> nbits_dict;
+  MarkerIdFilter _idFilter;
 };
 
 } // namespace aruco
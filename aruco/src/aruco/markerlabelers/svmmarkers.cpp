@@ -114,9 +114,8 @@ public:
     return true;
   }
 
-  /**
-   */
-  bool detect(const cv::Mat &in, int &mid, int &nRotations)
+  // writes in dataRow (1 x _patchSize^2, CV_32FC1) the features of the canonical image in
+  void features(const cv::Mat &in, cv::Mat dataRow)
   {
     // convert to gray
     assert(in.rows == in.cols);
@@ -133,13 +132,18 @@ public:
     else
       greyResized = grey;
 
-    // normalize image range
+    // normalize image range, and rearrange data in a row
     cv::Mat greyResizedNormalized;
     cv::normalize(greyResized, greyResizedNormalized, _minFeatureValue, _maxFeatureValue, cv::NORM_MINMAX, CV_32FC1);
+    greyResizedNormalized.reshape(1, 1).copyTo(dataRow);
+  }
 
-    // rearrange data in a row
-    cv::Mat dataRow;
-    dataRow = greyResizedNormalized.reshape(1, 1);
+  /**
+   */
+  bool detect(const cv::Mat &in, int &mid, int &nRotations)
+  {
+    cv::Mat dataRow(1, _patchSize * _patchSize, CV_32FC1);
+    features(in, dataRow);
 
     // predict id with svm
 #if  CV_VERSION_MAJOR >= 3
@@ -147,7 +151,39 @@ public:
 #else
     int predict_id = (int)_model->predict(dataRow, true);
 #endif /* CV_MAJOR_VERSION >= 3 */
+    return decode(predict_id, mid, nRotations);
+  }
+
+  /**
+   * Classifies all the images with a single prediction
+   */
+  void detect(const std::vector<cv::Mat> &in, std::vector<MarkerLabeler::Label> &labels)
+  {
+    labels.resize(in.size());
+    if (in.empty())
+      return;
+    _samples.create(int(in.size()), _patchSize * _patchSize, CV_32FC1);
+    for (std::size_t i = 0; i < in.size(); i++)
+      features(in[i], _samples.row(int(i)));
+
+#if  CV_VERSION_MAJOR >= 3
+    _model->predict(_samples, _results);
+#else
+    _results.create(_samples.rows, 1, CV_32FC1);
+    for (int i = 0; i < _samples.rows; i++)
+      _results.at<float>(i) = _model->predict(_samples.row(i), true);
+#endif /* CV_MAJOR_VERSION >= 3 */
+
+    for (std::size_t i = 0; i < in.size(); i++)
+      labels[i].isMarker = decode(int(_results.at<float>(int(i))), labels[i].id, labels[i].nRotations);
+  }
+
+private:
+  cv::Mat _samples, _results; // features and predictions of the images of detect(), one per row
 
+  // gets the id and rotation of the class predicted. Returns false for the invalid marker class
+  bool decode(int predict_id, int &mid, int &nRotations) const
+  {
     // get rotation of marker
     nRotations = predict_id % 4;
 
@@ -192,6 +228,13 @@ bool SVMMarkers::detect(const cv::Mat &in, int &marker_id, int &nRotations, std:
   return res;
 }
 
+void SVMMarkers::detectBatch(const std::vector<cv::Mat> &in, std::vector<Label> &labels)
+{
+  _impl->detect(in, labels);
+  for (auto &label : labels)
+    label.additionalInfo = label.isMarker ? "SVM" : "";
+}
+
 int SVMMarkers::getBestInputSize()
 {
   return _impl->getBestInputSize();
@@ -72,6 +72,14 @@ public:
    * Assign the detected rotation of the marker to nRotation
    */
   bool detect(const cv::Mat &in, int & marker_id, int &nRotations, std::string &additionalInfo);
+
+  // stacks the features of all the candidates in a matrix and classifies them with a single prediction
+  void detectBatch(const std::vector<cv::Mat> &in, std::vector<Label> &labels);
+  bool supportsBatchDetection() const
+  {
+    return true;
+  }
+
   int getBestInputSize();
 };
 
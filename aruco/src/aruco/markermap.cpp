@@ -32,6 +32,7 @@
 #include <opencv2/calib3d.hpp>
 #include <opencv2/imgproc.hpp>
 
+#include <cstring>
 #include <fstream>
 
 namespace aruco
@@ -149,25 +150,56 @@ void MarkerMap::readFromFile(cv::FileStorage& fs)
 
   if (fs["aruco_bc_dict"].name() == "aruco_bc_dict")
     fs["aruco_bc_dict"] >> dictionary;
+  buildIndex();
+}
+
+/**
+ */
+void MarkerMap::buildIndex()
+{
+  _idIndex.clear();
+  _idIndex.reserve(size());
+  // if an id is repeated, the first element is the one found, as in a linear search
+  for (std::size_t i = 0; i < size(); i++)
+    _idIndex.insert(std::make_pair(at(i).id, static_cast<int>(i)));
+  _indexedSize = size();
+  _metricMap.reset();
 }
 
 /**
  */
 int MarkerMap::getIndexOfMarkerId(int id) const
 {
+  if (_indexedSize == size())
+  {
+    auto it = _idIndex.find(id);
+    if (it != _idIndex.end() && at(it->second).id == id)
+      return it->second;
+  }
+
+  // not in the index, or the elements have been changed since it was built (e.g. an id edited in place), so the
+  // index can not tell that the id is missing
   for (std::size_t i = 0; i < size(); i++)
     if (at(i).id == id)
       return static_cast<int>(i);
   return -1;
 }
 
+/**
+ */
+const Marker3DInfo* MarkerMap::findMarker3DInfo(int id) const
+{
+  int idx = getIndexOfMarkerId(id);
+  return idx < 0 ? nullptr : &at(idx);
+}
+
 /**
  */
 const Marker3DInfo& MarkerMap::getMarker3DInfo(int id) const
 {
-  for (std::size_t i = 0; i < size(); i++)
-    if (at(i).id == id)
-      return at(i);
+  const Marker3DInfo* info = findMarker3DInfo(id);
+  if (info != nullptr)
+    return *info;
   throw cv::Exception(111, "MarkerMap::getMarker3DInfo", "Marker with the id given is not found", __FILE__, __LINE__);
 }
 
@@ -342,10 +374,10 @@ MarkerMap MarkerMap::convertToMeters(float markerSize_meters)
   int markerSizePix = static_cast<int>(cv::norm(at(0)[0] - at(0)[1]));
   MarkerMap BInfo(*this);
   BInfo.mInfoType = MarkerMap::METERS;
+  BInfo._metricMap.reset();
 
   // now, get the size of a pixel, and change scale
   float pixSize = markerSize_meters / float(markerSizePix);
-  std::cout << markerSize_meters << " " << float(markerSizePix) << " " << pixSize << std::endl;
   for (std::size_t i = 0; i < BInfo.size(); i++)
     for (int c = 0; c < 4; c++)
     {
@@ -354,6 +386,44 @@ MarkerMap MarkerMap::convertToMeters(float markerSize_meters)
 
   return BInfo;
 }
+
+const MarkerMap& MarkerMap::getMetricMap(float markerSize)
+{
+  if (!isExpressedInPixels())
+    return *this;
+  // the elements may have been edited in place since the conversion, it is a public vector
+  uint64_t sum = checksum();
+  if (!_metricMap || _metricMarkerSize != markerSize || _metricChecksum != sum)
+  {
+    _metricMap = std::make_shared<MarkerMap>(convertToMeters(markerSize));
+    _metricMarkerSize = markerSize;
+    _metricChecksum = sum;
+  }
+  return *_metricMap;
+}
+
+uint64_t MarkerMap::checksum() const
+{
+  // FNV-1a over the ids and the bits of the coordinates
+  uint64_t hash = 14695981039346656037ull;
+  auto add = [&hash](uint32_t v)
+  {
+    hash = (hash ^ v) * 1099511628211ull;
+  };
+  add(static_cast<uint32_t>(size()));
+  for (const Marker3DInfo &info : *this)
+  {
+    add(static_cast<uint32_t>(info.id));
+    for (const cv::Point3f &p : info.points)
+      for (float c : {p.x, p.y, p.z})
+      {
+        uint32_t bits;
+        std::memcpy(&bits, &c, sizeof(bits));
+        add(bits);
+      }
+  }
+  return hash;
+}
 cv::Mat MarkerMap::getImage(float METER2PIX) const
 {
   if (mInfoType == NONE)
@@ -418,17 +488,8 @@ std::vector<int> MarkerMap::getIndices(const std::vector<aruco::Marker>& markers
 {
   std::vector<int> indices;
   for (std::size_t i = 0; i < markers.size(); i++)
-  {
-    bool found = false;
-    for (std::size_t j = 0; j < size() && !found; j++)
-    {
-      if (markers[i].id == at(j).id)
-      {
-        found = true;
-        indices.push_back(static_cast<int>(i));
-      }
-    }
-  }
+    if (getIndexOfMarkerId(markers[i].id) >= 0)
+      indices.push_back(static_cast<int>(i));
   return indices;
 }
 
@@ -450,28 +511,25 @@ void MarkerMap::fromStream(std::istream& str)
   for (std::size_t i = 0; i < size(); i++)
     at(i).fromStream(str);
   str >> dictionary;
+  buildIndex();
 }
 
 std::pair<cv::Mat, cv::Mat> MarkerMap::calculateExtrinsics(const std::vector<aruco::Marker>& markers, float markerSize,
                                                            cv::Mat CameraMatrix, cv::Mat Distorsion)
 {
+  const MarkerMap& m_meters = getMetricMap(markerSize);
   std::vector<cv::Point2f> p2d;
-  MarkerMap m_meters;
-  if (isExpressedInPixels())
-    m_meters = convertToMeters(markerSize);
-  else
-    m_meters = *this;
   std::vector<cv::Point3f> p3d;
-  for (auto marker : markers)
+  p2d.reserve(4 * markers.size());
+  p3d.reserve(4 * markers.size());
+  for (const Marker& marker : markers)
   {
-    auto it = std::find(m_meters.begin(), m_meters.end(), marker.id);
-    if (it != m_meters.end())
+    // is the marker part of the map?
+    const Marker3DInfo* info = m_meters.findMarker3DInfo(marker.id);
+    if (info != nullptr)
     {
-      // is the marker part of the map?
-      for (auto p : marker)
-        p2d.push_back(p);
-      for (auto p : it->points)
-        p3d.push_back(p);
+      p2d.insert(p2d.end(), marker.begin(), marker.end());
+      p3d.insert(p3d.end(), info->points.begin(), info->points.end());
     }
   }
 
@@ -28,6 +28,9 @@
 
 #include "posetracker.h"
 #include "ippe.h"
+#include <atomic>
+#include <functional>
+#include <limits>
 #include <set>
 #include "levmarq.h"
 #include <opencv2/calib3d.hpp>
@@ -353,25 +356,198 @@ double __aruco_solve_pnp(const std::vector<cv::Point3f>& p3d, const std::vector<
   return err;
 }
 
+/**
+ * Robust reprojection error of N points (Eigen::Dynamic if the number is only known at run time) for a pinhole
+ * camera with up to 8 distortion coefficients (k1, k2, p1, p2, k3, k4, k5, k6), as the problem of LevMarqFixed. The
+ * parameters are the rotation vector and the translation. The jacobian is computed analytically, and the errors
+ * are weighted as in __aruco_solve_pnp
+ */
+template<typename T, int N>
+struct PnPProblem
+{
+  typedef typename LevMarqFixed<T, 6>::eVector eVector;
+  typedef typename LevMarqFixed<T, 6>::eMatrix eMatrix;
+  typedef Eigen::Matrix<T, 3, 1> eVector3;
+  typedef Eigen::Matrix<T, 3, 3> eMatrix3;
+
+  const cv::Point3f *p3d;
+  const cv::Point2f *p2d;
+  int n; // number of points if N is Eigen::Dynamic
+  T fx, fy, cx, cy;
+  T k[8]; // distortion coefficients, the ones not given are zero
+
+  static eMatrix3 skew(const eVector3 &v)
+  {
+    eMatrix3 S;
+    S << T(0), -v(2), v(1), v(2), T(0), -v(0), -v(1), v(0), T(0);
+    return S;
+  }
+
+  double operator()(const eVector &z, eMatrix *JtJ, eVector *Jtf) const
+  {
+    eVector3 rv = z.template head<3>(), t = z.template tail<3>();
+
+    // Rodrigues formula, and the derivatives dR/drv_i * R^t (Gallego and Yezzi, 2015):
+    // dR/drv_i = (rv_i [rv]x + [rv x (I - R) e_i]x) R / |rv|^2, that near rv = 0 is [e_i]x R
+    T theta2 = rv.squaredNorm();
+    eMatrix3 Rx = skew(rv), R;
+    eMatrix3 dR[3];
+    if (theta2 < T(1e-12))
+    {
+      R = eMatrix3::Identity() + Rx;
+      for (int i = 0; i < 3; i++)
+        dR[i] = skew(eVector3::Unit(i));
+    }
+    else
+    {
+      T theta = std::sqrt(theta2);
+      R = eMatrix3::Identity() + (std::sin(theta) / theta) * Rx + ((T(1) - std::cos(theta)) / theta2) * Rx * Rx;
+      for (int i = 0; i < 3; i++)
+        dR[i] = (rv(i) * Rx + skew(Rx * (eVector3::Unit(i) - R.col(i)))) / theta2;
+    }
+
+    if (JtJ)
+    {
+      JtJ->setZero();
+      Jtf->setZero();
+    }
+    double err = 0;
+    const int npoints = N == Eigen::Dynamic ? n : N;
+    for (int i = 0; i < npoints; i++)
+    {
+      eVector3 RX = R * eVector3(T(p3d[i].x), T(p3d[i].y), T(p3d[i].z));
+      eVector3 P = RX + t;
+      T iz = T(1) / P(2);
+      T x = P(0) * iz, y = P(1) * iz;
+      T r2 = x * x + y * y, r4 = r2 * r2, r6 = r4 * r2;
+      T a = T(1) + k[0] * r2 + k[1] * r4 + k[4] * r6;
+      T b = T(1) + k[5] * r2 + k[6] * r4 + k[7] * r6;
+      T radial = a / b;
+      T xd = x * radial + T(2) * k[2] * x * y + k[3] * (r2 + T(2) * x * x);
+      T yd = y * radial + k[2] * (r2 + T(2) * y * y) + T(2) * k[3] * x * y;
+      T ex = fx * xd + cx - T(p2d[i].x), ey = fy * yd + cy - T(p2d[i].y);
+
+      double SqErr = ex * ex + ey * ey;
+      T w = SqErr > 0 ? T(getHubberMonoWeight(SqErr, 1)) : T(1);
+      ex *= w;
+      ey *= w;
+      err += ex * ex + ey * ey;
+      if (!JtJ)
+        continue;
+
+      // derivatives of the distorted point with respect to the normalized one
+      T dradial = ((k[0] + T(2) * k[1] * r2 + T(3) * k[4] * r4) * b - a * (k[5] + T(2) * k[6] * r2 + T(3) * k[7] * r4))
+          / (b * b);
+      T drx = dradial * T(2) * x, dry = dradial * T(2) * y;
+      T dxd_dx = radial + x * drx + T(2) * k[2] * y + T(6) * k[3] * x;
+      T dxd_dy = x * dry + T(2) * k[2] * x + T(2) * k[3] * y;
+      T dyd_dx = y * drx + T(2) * k[2] * x + T(2) * k[3] * y;
+      T dyd_dy = radial + y * dry + T(6) * k[2] * y + T(2) * k[3] * x;
+
+      // derivatives of the pixel with respect to the point in the camera frame, and then to the pose
+      Eigen::Matrix<T, 2, 3> JP;
+      JP << fx * dxd_dx * iz, fx * dxd_dy * iz, -fx * (dxd_dx * x + dxd_dy * y) * iz,
+            fy * dyd_dx * iz, fy * dyd_dy * iz, -fy * (dyd_dx * x + dyd_dy * y) * iz;
+      Eigen::Matrix<T, 2, 6> J;
+      for (int c = 0; c < 3; c++)
+        J.col(c) = JP * (dR[c] * RX);
+      J.template rightCols<3>() = JP;
+      J *= w;
+      *JtJ += J.transpose() * J;
+      *Jtf += J.transpose() * Eigen::Matrix<T, 2, 1>(ex, ey);
+    }
+    return err;
+  }
+};
+
+// value i (in row-major order) of a float or double matrix
+static double matValue(const cv::Mat &m, int i)
+{
+  int r = i / m.cols, c = i % m.cols;
+  return m.depth() == CV_64F ? m.at<double>(r, c) : static_cast<double>(m.at<float>(r, c));
+}
+
+// as __aruco_solve_pnp, with the fixed size solver and analytic jacobian. It does not allocate memory. Returns
+// false if the distortion model is not supported
+template<typename T, int N>
+bool __aruco_solve_pnp_fixed(const std::vector<cv::Point3f>& p3d, const std::vector<cv::Point2f>& p2d,
+                             const cv::Mat& cam_matrix, const cv::Mat& dist, cv::Mat& r_io, cv::Mat& t_io,
+                             double &err)
+{
+  assert(r_io.type() == CV_32F && r_io.total() == 3 && r_io.isContinuous());
+  assert(t_io.type() == CV_32F && t_io.total() == 3 && t_io.isContinuous());
+  assert(p3d.size() == p2d.size());
+  int ndist = static_cast<int>(dist.total());
+  if (ndist > 8 || (N != Eigen::Dynamic && static_cast<int>(p3d.size()) != N))
+    return false;
+
+  PnPProblem<T, N> problem;
+  problem.p3d = p3d.data();
+  problem.p2d = p2d.data();
+  problem.n = static_cast<int>(p3d.size());
+  problem.fx = T(matValue(cam_matrix, 0));
+  problem.cx = T(matValue(cam_matrix, 2));
+  problem.fy = T(matValue(cam_matrix, 4));
+  problem.cy = T(matValue(cam_matrix, 5));
+  for (int i = 0; i < 8; i++)
+    problem.k[i] = i < ndist ? T(matValue(dist, i)) : T(0);
+
+  typename LevMarqFixed<T, 6>::eVector sol;
+  float *r = r_io.ptr<float>(0), *t = t_io.ptr<float>(0);
+  for (int i = 0; i < 3; i++)
+  {
+    sol(i) = r[i];
+    sol(i + 3) = t[i];
+  }
+
+  // same parameters as __aruco_solve_pnp
+  LevMarqFixed<T, 6> solver(100, 0.01, 0.01);
+  err = solver.solve(sol, problem);
+
+  for (int i = 0; i < 3; i++)
+  {
+    r[i] = static_cast<float>(sol(i));
+    t[i] = static_cast<float>(sol(i + 3));
+  }
+  return true;
+}
+
 double __aruco_solve_pnp(const std::vector<cv::Point3f>& p3d, const std::vector<cv::Point2f>& p2d,
                          const cv::Mat& cam_matrix, const cv::Mat& dist, cv::Mat& r_io, cv::Mat& t_io)
 {
-
 #ifdef DOUBLE_PRECISION_PNP
-  return __aruco_solve_pnp<double>(p3d, p2d, cam_matrix, dist, r_io, t_io);
+  typedef double T;
 #else
-  return __aruco_solve_pnp<float>(p3d, p2d, cam_matrix, dist, r_io, t_io);
+  typedef float T;
 #endif
 
+  // a single marker has its four points known at compile time, a map any number of them
+  double err;
+  if (p3d.size() == 4 ? __aruco_solve_pnp_fixed<T, 4>(p3d, p2d, cam_matrix, dist, r_io, t_io, err)
+                      : __aruco_solve_pnp_fixed<T, Eigen::Dynamic>(p3d, p2d, cam_matrix, dist, r_io, t_io, err))
+    return err;
+  return __aruco_solve_pnp<T>(p3d, p2d, cam_matrix, dist, r_io, t_io);
+}
+
+double refinePnP(const std::vector<cv::Point3f>& objPoints, const std::vector<cv::Point2f>& imgPoints,
+                 const cv::Mat& cameraMatrix, const cv::Mat& distCoeffs, cv::Mat& r_io, cv::Mat& t_io)
+{
+  return __aruco_solve_pnp(objPoints, imgPoints, cameraMatrix, distCoeffs, r_io, t_io);
 }
 
 bool MarkerPoseTracker::estimatePose(Marker& m, const CameraParameters& _cam_params, float _msize, float minerrorRatio)
+{
+  _camera.prepare(_cam_params, _cam_params.CamSize);
+  return estimatePose(m, _camera, _msize, minerrorRatio);
+}
+
+bool MarkerPoseTracker::estimatePose(Marker& m, const PreparedCamera& camera, float _msize, float minerrorRatio)
 {
   if (_rvec.empty())
   {
     // if no previous data, use from scratch
     cv::Mat rv, tv;
-    auto solutions = solvePnP_(Marker::get3DPoints(_msize), m, _cam_params.CameraMatrix, _cam_params.Distorsion);
+    auto solutions = solvePnP_(_msize, m, camera);
     double errorRatio = solutions[1].second / solutions[0].second;
     if (errorRatio < minerrorRatio)
       return false;
@@ -381,11 +557,11 @@ bool MarkerPoseTracker::estimatePose(Marker& m, const CameraParameters& _cam_par
 //    __aruco_solve_pnp(Marker::get3DPoints(_msize), m, _cam_params.CameraMatrix, _cam_params.Distorsion, _rvec, _tvec);
 //    rv.convertTo(_rvec, CV_32F);
 //    tv.convertTo(_tvec, CV_32F);
-//    aruco_private::impl__aruco_getRTfromMatrix44(solutions[0].first, _rvec, _tvec);
+    aruco_private::impl__aruco_getRTfromMatrix44(solutions[0].first, _rvec, _tvec);
   }
   else
   {
-    __aruco_solve_pnp(Marker::get3DPoints(_msize), m, _cam_params.CameraMatrix, _cam_params.Distorsion, _rvec, _tvec);
+    __aruco_solve_pnp(Marker::get3DPoints(_msize), m, camera.CameraMatrix, camera.Distorsion, _rvec, _tvec);
   }
 
   _rvec.convertTo(m.Rvec, CV_32F);
@@ -394,10 +570,98 @@ bool MarkerPoseTracker::estimatePose(Marker& m, const CameraParameters& _cam_par
   return true;
 }
 
+MultiMarkerPoseTracker::MultiMarkerPoseTracker(int maxAge, float minErrorRatio, float maxReprojError) :
+    _frame(0), _maxAge(maxAge), _minErrorRatio(minErrorRatio), _maxReprojError(maxReprojError)
+{
+}
+
+void MultiMarkerPoseTracker::estimatePoses(std::vector<Marker>& markers, const CameraParameters& cam_params,
+                                           cv::Size imageSize, float markerSize)
+{
+  if (!cam_params.isValid() || markerSize <= 0)
+    return;
+  _camera.prepare(cam_params, imageSize);
+  estimatePoses(markers, _camera, markerSize);
+}
+
+void MultiMarkerPoseTracker::estimatePoses(std::vector<Marker>& markers, const PreparedCamera& camera,
+                                           float markerSize)
+{
+  _frame++;
+  for (Marker &m : markers)
+  {
+    auto it = _tracks.find(m.id);
+    if (it == _tracks.end())
+    {
+      it = _tracks.insert(std::make_pair(m.id, Track())).first;
+    }
+    else if (it->second.lastFrame == _frame)
+    {
+      // the id is repeated in this frame (e.g. markers of several dictionaries), only the first one is tracked
+      m.calculateExtrinsicsIPPE(markerSize, camera, false);
+      continue;
+    }
+    Track &track = it->second;
+    track.lastFrame = _frame;
+    track.refined = false;
+
+    // refine the pose of the previous frame, and start again if it is lost
+    if (track.tracker.isTracking())
+    {
+      track.tracker.estimatePose(m, camera, markerSize, _minErrorRatio);
+      track.refined = reprojectionError(m, camera, markerSize) <= _maxReprojError;
+      if (!track.refined)
+        track.tracker.reset();
+    }
+
+    if (!track.refined && !track.tracker.estimatePose(m, camera, markerSize, _minErrorRatio))
+    {
+      // ambiguous, the track is not started yet
+      m.calculateExtrinsicsIPPE(markerSize, camera, false);
+      continue;
+    }
+
+    // the trackers work in the camera frame, without the offset of the stereo extrinsics
+    m.Tvec.ptr<float>(0)[0] += camera.Offset.x;
+    m.Tvec.ptr<float>(0)[1] += camera.Offset.y;
+    m.Tvec.ptr<float>(0)[2] += camera.Offset.z;
+    m.poseErrorRatio = 0;
+    m.Rvec2.release();
+    m.Tvec2.release();
+  }
+
+  // forget the markers not seen for a while
+  for (auto it = _tracks.begin(); it != _tracks.end();)
+  {
+    if (_frame - it->second.lastFrame > static_cast<uint64_t>(_maxAge))
+      it = _tracks.erase(it);
+    else
+      ++it;
+  }
+}
+
+bool MultiMarkerPoseTracker::isTracked(int id) const
+{
+  auto it = _tracks.find(id);
+  return it != _tracks.end() && it->second.lastFrame == _frame && it->second.refined;
+}
+
+double MultiMarkerPoseTracker::reprojectionError(const Marker& m, const PreparedCamera& camera, float markerSize)
+{
+  std::vector<cv::Point2f> projected;
+  cv::projectPoints(Marker::get3DPoints(markerSize), m.Rvec, m.Tvec, camera.CameraMatrix, camera.Distorsion,
+                    projected);
+  double sum = 0;
+  for (std::size_t i = 0; i < projected.size(); i++)
+    sum += cv::norm(m[i] - projected[i]);
+  return sum / double(projected.size());
+}
+
 MarkerMapPoseTracker::MarkerMapPoseTracker()
 {
   _isValid = false;
   aruco_minerrratio_valid = 3;
+  _relocalizationSubset = 24;
 }
 
 void MarkerMapPoseTracker::setParams(const CameraParameters& cam_params, const MarkerMap& msconf, float markerSize)
@@ -407,6 +671,7 @@ void MarkerMapPoseTracker::setParams(const CameraParameters& cam_params, const M
   if (!cam_params.isValid())
     throw cv::Exception(9001, "Invalid camera parameters", "MarkerMapPoseTracker::setParams", __FILE__,
     __LINE__);
+  _camera.prepare(_cam_params, _cam_params.CamSize);
   if (_msconf.mInfoType == MarkerMap::PIX && markerSize <= 0)
     throw cv::Exception(9001, "You should indicate the markersize since the MarkerMap is in pixels",
                         "MarkerMapPoseTracker::setParams", __FILE__, __LINE__);
@@ -419,7 +684,8 @@ void MarkerMapPoseTracker::setParams(const CameraParameters& cam_params, const M
 
   // create a map for fast access to elements
   _map_mm.clear();
-  for (auto m : msconf)
+  marker_m2g.clear();
+  for (auto m : _msconf)
     _map_mm.insert(std::make_pair(m.id, m));
 
   // now, compute the marker_m2g map
@@ -437,85 +703,127 @@ void MarkerMapPoseTracker::setParams(const CameraParameters& cam_params, const M
 
 cv::Mat MarkerMapPoseTracker::relocalization(const std::vector<Marker>& v_m)
 {
-  // get the markers in v_m that are in the map
-  std::vector<Marker> mapMarkers;
-  for (auto marker : v_m)
+  // get the markers in v_m that are in the map, looking them up only once
+  struct mapMarker
+  {
+    const Marker *marker;
+    const Marker3DInfo *info;
+    const cv::Mat *m2g;
+  };
+  std::vector<mapMarker> mapMarkers;
+  mapMarkers.reserve(v_m.size());
+  for (const Marker &marker : v_m)
   {
-    if (_map_mm.find(marker.id) != _map_mm.end())
-      mapMarkers.push_back(marker);
+    auto it = _map_mm.find(marker.id);
+    if (it != _map_mm.end())
+      mapMarkers.push_back(mapMarker {&marker, &it->second, &marker_m2g.find(marker.id)->second});
   }
 
   if (mapMarkers.size() == 0)
     return cv::Mat();
-  struct minfo
+
+  auto parallelFor = [this](std::size_t n, const std::function<void(std::size_t)> &func)
   {
-    int id;
-    cv::Mat rt_f2m;
-    double err;
+    if (_threadPool)
+      _threadPool->run(n, func);
+    else
+      for (std::size_t i = 0; i < n; i++)
+        func(i);
   };
-  struct se3
+
+  // each visible marker gives two hypotheses of the camera pose, one per IPPE solution
+  struct hypothesis
   {
-    float rt[6];
+    cv::Mat pose_f2g;
+    double ippeErr; // reprojection error of the marker that gives it
+    // reprojection error of the scored markers. Hypotheses abandoned during the scoring keep a partial sum, only
+    // valid to tell that they are not the best
+    double globalErr = std::numeric_limits<double>::max();
+    bool good; // first solution of an unambiguous marker
   };
+  std::vector<hypothesis> hypotheses(2 * mapMarkers.size());
+  parallelFor(mapMarkers.size(), [&](std::size_t i)
+  {
+    const mapMarker &mm = mapMarkers[i];
+    auto mpi = solvePnP_(mm.info->getMarkerSize(), *mm.marker, _camera);
+    bool good = mpi[1].second / mpi[0].second > aruco_minerrratio_valid;
+    for (int j = 0; j < 2; j++)
+    {
+      hypothesis &h = hypotheses[2 * i + j];
+      h.pose_f2g = mpi[j].first * (*mm.m2g);
+      h.ippeErr = mpi[j].second;
+      h.good = good && j == 0;
+    }
+  });
 
   cv::Mat pose_f2g_out; //result
 
-  // estimate the markers locations and see if there is at least one good enough
-  std::vector<minfo> good_marker_locations;
-  std::vector<minfo> all_marker_locations;
-
-  for (const Marker &marker : mapMarkers)
-  {
-    // for each visible marker
-    auto mpi = solvePnP_(_map_mm[marker.id].getMarkerSize(), marker, _cam_params.CameraMatrix, _cam_params.Distorsion);
-    minfo mi;
-    mi.id = marker.id;
-    mi.err = mpi[0].second;
-    mi.rt_f2m = mpi[0].first;
-    all_marker_locations.push_back(mi);
-    if (mpi[1].second / mpi[0].second > aruco_minerrratio_valid)
-      good_marker_locations.push_back(mi);
-    mi.rt_f2m = mpi[1].first;
-    mi.err = mpi[1].second;
-    all_marker_locations.push_back(mi);
-  }
-
   // try using more than one marker approach
   if (mapMarkers.size() >= 2)
   {
-    // collect all the markers 3D locations
+    // the hypotheses are scored with the points of all the markers, or of a subset spread over them for large maps
+    std::size_t nscore = mapMarkers.size();
+    if (_relocalizationSubset > 0 && nscore > std::size_t(_relocalizationSubset))
+      nscore = _relocalizationSubset;
     std::vector<cv::Point2f> markerPoints2d;
     std::vector<cv::Point3f> markerPoints3d;
-    for (const Marker &marker : mapMarkers)
+    markerPoints2d.reserve(4 * nscore);
+    markerPoints3d.reserve(4 * nscore);
+    for (std::size_t i = 0; i < nscore; i++)
     {
-      markerPoints2d.insert(markerPoints2d.end(), marker.begin(), marker.end());
-      auto p3d = _map_mm[marker.id].points;
-      markerPoints3d.insert(markerPoints3d.end(), p3d.begin(), p3d.end());
+      const mapMarker &mm = mapMarkers[i * mapMarkers.size() / nscore];
+      markerPoints2d.insert(markerPoints2d.end(), mm.marker->begin(), mm.marker->end());
+      markerPoints3d.insert(markerPoints3d.end(), mm.info->points.begin(), mm.info->points.end());
     }
-
-    // take the all poses and select the one that minimizes the global reproj error
-    for (auto & ml : all_marker_locations)
+    // undistort once, so that each hypothesis is projected with the pinhole model only
+    std::vector<cv::Point2f> normalized;
+    _camera.undistortPoints(markerPoints2d, normalized);
+    const float fx = _camera.CameraMatrix.at<float>(0, 0), fy = _camera.CameraMatrix.at<float>(1, 1);
+
+    // take all the poses and select the one that minimizes the global reprojection error. A hypothesis is
+    // abandoned as soon as its error exceeds the one of the best hypothesis found so far
+    std::atomic<double> bestErr(std::numeric_limits<double>::max());
+    parallelFor(hypotheses.size(), [&](std::size_t h)
     {
-      auto pose = ml.rt_f2m * marker_m2g[ml.id];
-      // now, compute the repj error of all markers using this info
-      ml.err = aruco_private::reprj_error(markerPoints3d, markerPoints2d, _cam_params, pose);
-    }
-    // sort and get the best
-    std::sort(all_marker_locations.begin(), all_marker_locations.end(), [](const minfo &a,const minfo &b)
-    { return a.err<b.err;});
-    std::cerr << "err = " << all_marker_locations.front().err << std::endl;
-    auto &best = all_marker_locations.front();
-    pose_f2g_out = best.rt_f2m * marker_m2g[best.id];
+      const float *rt = hypotheses[h].pose_f2g.ptr<float>(0);
+      double sum = 0;
+      for (std::size_t i = 0; i < markerPoints3d.size(); i++)
+      {
+        const cv::Point3f &p = markerPoints3d[i];
+        float z = rt[8] * p.x + rt[9] * p.y + rt[10] * p.z + rt[11];
+        if (z <= 0)
+        {
+          // the map would be behind the camera
+          sum = std::numeric_limits<double>::max();
+          break;
+        }
+        float dx = (rt[0] * p.x + rt[1] * p.y + rt[2] * p.z + rt[3]) / z - normalized[i].x;
+        float dy = (rt[4] * p.x + rt[5] * p.y + rt[6] * p.z + rt[7]) / z - normalized[i].y;
+        sum += std::sqrt(fx * fx * dx * dx + fy * fy * dy * dy);
+        if (i % 4 == 3 && sum >= bestErr.load(std::memory_order_relaxed))
+          break;
+      }
+      hypotheses[h].globalErr = sum;
+      double best = bestErr.load();
+      while (sum < best && !bestErr.compare_exchange_weak(best, sum))
+        ;
+    });
+
+    auto best = std::min_element(hypotheses.begin(), hypotheses.end(), [](const hypothesis &a, const hypothesis &b)
+    { return a.globalErr < b.globalErr;});
+    if (best->globalErr < std::numeric_limits<double>::max())
+      pose_f2g_out = best->pose_f2g;
   }
 
-  if (pose_f2g_out.empty() && good_marker_locations.size() > 0)
+  if (pose_f2g_out.empty())
   {
-    std::sort(good_marker_locations.begin(), good_marker_locations.end(), [](const minfo &a,const minfo &b)
-    { return a.err < b.err;});
-    auto best = good_marker_locations[0];
-
-    // estimate current location
-    pose_f2g_out = best.rt_f2m * marker_m2g[best.id];
+    // estimate current location from the best unambiguous marker
+    const hypothesis *best = nullptr;
+    for (const hypothesis &h : hypotheses)
+      if (h.good && (best == nullptr || h.ippeErr < best->ippeErr))
+        best = &h;
+    if (best != nullptr)
+      pose_f2g_out = best->pose_f2g;
   }
   return pose_f2g_out;
 }
@@ -524,15 +832,16 @@ bool MarkerMapPoseTracker::estimatePose(const std::vector<Marker>& v_m)
 {
   std::vector<cv::Point2f> p2d;
   std::vector<cv::Point3f> p3d;
-  for (auto marker : v_m)
+  p2d.reserve(4 * v_m.size());
+  p3d.reserve(4 * v_m.size());
+  for (const Marker &marker : v_m)
   {
-    if (_map_mm.find(marker.id) != _map_mm.end())
+    // is the marker part of the map?
+    auto it = _map_mm.find(marker.id);
+    if (it != _map_mm.end())
     {
-      // is the marker part of the map?
-      for (auto p : marker)
-        p2d.push_back(p);
-      for (auto p : _map_mm[marker.id].points)
-        p3d.push_back(p);
+      p2d.insert(p2d.end(), marker.begin(), marker.end());
+      p3d.insert(p3d.end(), it->second.points.begin(), it->second.points.end());
     }
   }
 
@@ -557,7 +866,7 @@ bool MarkerMapPoseTracker::estimatePose(const std::vector<Marker>& v_m)
     }
 
     // refine
-    __aruco_solve_pnp(p3d, p2d, _cam_params.CameraMatrix, _cam_params.Distorsion, _rvec, _tvec);
+    __aruco_solve_pnp(p3d, p2d, _camera.CameraMatrix, _camera.Distorsion, _rvec, _tvec);
 
     return true;
   }
@@ -0,0 +1,153 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+
+#include "quadextractor.h"
+
+#include <opencv2/imgproc.hpp>
+
+namespace aruco
+{
+
+namespace
+{
+// the 8 neighbours in counterclockwise order, starting at east
+const int neighbourDx[8] = {1, 1, 0, -1, -1, -1, 0, 1};
+const int neighbourDy[8] = {0, -1, -1, -1, 0, 1, 1, 1};
+}
+
+const std::vector<cv::Point> &QuadExtractor::extract(const cv::Mat &binary, int minContourPoints, double approxFactor)
+{
+  CV_Assert(binary.type() == CV_8UC1);
+  _quads.clear();
+
+  // copy the image with a background frame around it, so that neighbours never fall outside
+  _labels.create(binary.rows + 2, binary.cols + 2, CV_8SC1);
+  _labels.row(0).setTo(cv::Scalar(0));
+  _labels.row(_labels.rows - 1).setTo(cv::Scalar(0));
+  for (int y = 0; y < binary.rows; y++)
+  {
+    const uchar *in = binary.ptr<uchar>(y);
+    schar *out = _labels.ptr<schar>(y + 1);
+    out[0] = out[binary.cols + 1] = 0;
+    for (int x = 0; x < binary.cols; x++)
+      out[x + 1] = in[x] != 0;
+  }
+
+  // raster scan looking for the starting points of the borders that have not been followed yet
+  for (int y = 1; y <= binary.rows; y++)
+  {
+    const schar *row = _labels.ptr<schar>(y);
+    for (int x = 1; x <= binary.cols; x++)
+    {
+      schar v = row[x];
+      if (v == 0)
+        continue;
+      int startDir;
+      if (v == 1 && row[x - 1] == 0)
+        startDir = 4; // outer border
+      else if (v >= 1 && row[x + 1] == 0)
+        startDir = 0; // hole border
+      else
+        continue;
+
+      followBorder(x, y, startDir);
+      if (int(_contour.size()) > minContourPoints)
+        fitQuad(approxFactor);
+    }
+  }
+  return _quads;
+}
+
+void QuadExtractor::followBorder(int x, int y, int startDir)
+{
+  _contour.clear();
+  schar *data = _labels.ptr<schar>(0);
+  const int step = int(_labels.step);
+  int offset[8];
+  for (int d = 0; d < 8; d++)
+    offset[d] = neighbourDy[d] * step + neighbourDx[d];
+  schar *p0 = data + y * step + x;
+
+  // look clockwise for the first foreground neighbour, starting at the background one
+  int dir = startDir, i;
+  for (i = 0; i < 8; i++)
+  {
+    if (p0[offset[dir]] != 0)
+      break;
+    dir = (dir + 7) & 7;
+  }
+  if (i == 8)
+  {
+    // isolated pixel
+    *p0 = -2;
+    _contour.push_back(cv::Point(x - 1, y - 1));
+    return;
+  }
+
+  schar *p1 = p0 + offset[dir], *p3 = p0;
+  int x3 = x, y3 = y;
+  int dirTo2 = dir; // direction from the current pixel to the previous one
+  while (true)
+  {
+    // look counterclockwise for the next border pixel, starting after the previous one
+    bool eastIsBackground = false;
+    int d = dirTo2;
+    for (i = 0; i < 8; i++)
+    {
+      d = (d + 1) & 7;
+      if (p3[offset[d]] != 0)
+        break;
+      if (d == 0)
+        eastIsBackground = true;
+    }
+    schar *p4 = p3 + offset[d];
+
+    if (eastIsBackground)
+      *p3 = -2;
+    else if (*p3 == 1)
+      *p3 = 2;
+    _contour.push_back(cv::Point(x3 - 1, y3 - 1));
+
+    // back to the start?
+    if (p4 == p0 && p3 == p1)
+      break;
+    dirTo2 = (d + 4) & 7;
+    p3 = p4;
+    x3 += neighbourDx[d];
+    y3 += neighbourDy[d];
+  }
+}
+
+void QuadExtractor::fitQuad(double approxFactor)
+{
+  cv::approxPolyDP(_contour, _approx, double(_contour.size()) * approxFactor, true);
+  if (_approx.size() == 4 && cv::isContourConvex(_approx))
+    _quads.insert(_quads.end(), _approx.begin(), _approx.end());
+}
+
+} // namespace aruco
@@ -0,0 +1,221 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+
+#include "threadpool.h"
+#include "timers.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace aruco
+{
+
+namespace
+{
+// state shared by the jobs of one call to ThreadPool::run
+struct RunState
+{
+  std::atomic<std::size_t> next{0};
+  std::size_t n = 0;
+  const std::function<void(std::size_t)>* func = nullptr;
+  std::mutex mutex;
+  std::condition_variable cond;
+  int active = 0; // helpers currently inside work()
+  bool closed = false; // set by the caller once it is done, late helpers must not touch func
+  std::exception_ptr error;
+  TimerEventsRecorder* recorder = nullptr; // of the caller, the helpers record there too
+
+  void work()
+  {
+    std::size_t i;
+    while ((i = next++) < n)
+    {
+      try
+      {
+        (*func)(i);
+      }
+      catch (...)
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!error)
+          error = std::current_exception();
+        next = n;
+      }
+    }
+  }
+};
+}
+
+ThreadPool::ThreadPool(int nthreads)
+{
+  resize(nthreads);
+}
+
+ThreadPool::~ThreadPool()
+{
+  shutdown();
+}
+
+int ThreadPool::workersFor(int maxThreads)
+{
+  if (maxThreads <= 0)
+    return std::max(0, int(std::thread::hardware_concurrency()) - 1);
+  return maxThreads - 1;
+}
+
+void ThreadPool::resize(int nthreads)
+{
+  if (nthreads < 0)
+    nthreads = workersFor(-1);
+  if (nthreads == size())
+    return;
+  stop();
+  std::unique_lock<std::mutex> lock(_mutex);
+  for (int i = 0; i < nthreads; i++)
+    _workers.push_back(std::thread(&ThreadPool::workerLoop, this));
+}
+
+int ThreadPool::size() const
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  return int(_workers.size());
+}
+
+void ThreadPool::shutdown()
+{
+  stop();
+}
+
+void ThreadPool::stop()
+{
+  std::vector<std::thread> workers;
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _stopping = true;
+    workers.swap(_workers);
+  }
+  _cond.notify_all();
+  for (auto &th : workers)
+    th.join();
+  std::unique_lock<std::mutex> lock(_mutex);
+  _stopping = false;
+}
+
+void ThreadPool::workerLoop()
+{
+  while (true)
+  {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cond.wait(lock, [this]
+      { return _stopping || !_jobs.empty();});
+      if (_jobs.empty())
+        return; // stopping and nothing left to do
+      job = std::move(_jobs.front());
+      _jobs.pop();
+    }
+    job();
+  }
+}
+
+bool ThreadPool::push(const std::function<void()>& job)
+{
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_workers.empty())
+      return false;
+    _jobs.push(job);
+  }
+  _cond.notify_one();
+  return true;
+}
+
+void ThreadPool::run(std::size_t n, const std::function<void(std::size_t)>& func)
+{
+  if (n == 0)
+    return;
+  std::size_t nhelpers = std::min(std::size_t(size()), n - 1);
+  if (nhelpers == 0)
+  {
+    for (std::size_t i = 0; i < n; i++)
+      func(i);
+    return;
+  }
+
+  auto state = std::make_shared<RunState>();
+  state->n = n;
+  state->func = &func;
+  state->recorder = TimerEventsRecorder::current();
+  for (std::size_t h = 0; h < nhelpers; h++)
+  {
+    bool queued = push([state]
+    {
+      {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        if (state->closed)
+          return;
+        state->active++;
+      }
+      {
+        TimerEventsRecorder::Adopt adopt(state->recorder);
+        state->work();
+      }
+      {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->active--;
+      }
+      state->cond.notify_all();
+    });
+    if (!queued)
+      break;
+  }
+
+  // the caller works too. Helpers that did not start before it finishes are simply skipped
+  state->work();
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->closed = true;
+  state->cond.wait(lock, [&state]
+  { return state->active == 0;});
+  if (state->error)
+    std::rethrow_exception(state->error);
+}
+
+std::future<void> ThreadPool::async(const std::function<void()>& func)
+{
+  auto task = std::make_shared<std::packaged_task<void()>>(func);
+  std::future<void> fut = task->get_future();
+  if (!push([task]
+  { (*task)();}))
+    (*task)();
+  return fut;
+}
+
+} // namespace aruco
@@ -0,0 +1,75 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+
+#include "timers.h"
+
+#include <utility>
+
+namespace aruco
+{
+
+static thread_local TimerEventsRecorder *currentRecorder = nullptr;
+
+std::atomic<int> TimerEventsRecorder::_alive(0);
+
+TimerEventsRecorder::TimerEventsRecorder() :
+    _previous(currentRecorder)
+{
+  currentRecorder = this;
+  _alive++;
+}
+
+TimerEventsRecorder::~TimerEventsRecorder()
+{
+  currentRecorder = _previous;
+  _alive--;
+}
+
+void TimerEventsRecorder::add(Event event)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  events.push_back(std::move(event));
+}
+
+TimerEventsRecorder::Adopt::Adopt(TimerEventsRecorder *recorder) :
+    _previous(currentRecorder)
+{
+  currentRecorder = recorder;
+}
+
+TimerEventsRecorder::Adopt::~Adopt()
+{
+  currentRecorder = _previous;
+}
+
+TimerEventsRecorder* TimerEventsRecorder::current()
+{
+  return currentRecorder;
+}
+
+} // namespace aruco
@@ -0,0 +1,298 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+/**
+ * @file aruco_batch.cpp
+ * @brief Detects the markers of recorded sequences (video files or folders of images) with several detectors in
+ * parallel, see aruco::BatchDetector, and writes them as CSV or in a compact binary format.
+ *
+ * Usage: aruco_batch [options] <video or folder>..., being the options (default value in brackets):
+ *   --dictionary <ARUCO_MIP_36h12>
+ *   --mode <DM_NORMAL>    DM_NORMAL, DM_FAST, DM_VIDEO_FAST or DM_TRACKING. With the last two each sequence is
+ *                         processed by a single detector, so that the results match a sequential run
+ *   --min-size <0>        minimum marker size, as a fraction of the image (see MarkerDetector::setDetectionMode)
+ *   --thres <THRES_ADAPTIVE>  THRES_ADAPTIVE, THRES_AUTO_FIXED or THRES_ADAPTIVE_INTEGRAL
+ *   --camera <file>       camera parameters (yml). The poses are written if given together with --marker-size
+ *   --marker-size <-1>    side of the markers in meters
+ *   --workers <-1>        detectors running in parallel (-1 means one per hardware thread)
+ *   --max-in-flight <0>   frames held in memory at a time (0 means twice the workers)
+ *   --format <csv>        csv or binary
+ *   --output <file>       writes the results in the file instead of the standard output (required for binary)
+ *
+ * CSV: a header line and then one line per marker, with the columns
+ *   sequence,frame,name,id,x0,y0,x1,y1,x2,y2,x3,y3,rx,ry,rz,tx,ty,tz
+ * being sequence the index of the source in the command line, frame the index of the frame in it, and the pose
+ * (Rodrigues rotation and translation in meters) empty if it was not estimated. Frames without markers are omitted.
+ *
+ * Binary (little endian): the 8 bytes "ARUCOBT1", and then one record per frame, markers or not:
+ *   uint32 sequence, uint64 frame, uint16 length of the name, the name, uint32 number of markers, and per marker
+ *   int32 id, float32 corners[8] (x0, y0 ... x3, y3), uint8 has pose, float32 rvec[3], float32 tvec[3]
+ *
+ * Frames of different sequences may be interleaved, the frames of each sequence are in order.
+ * Rosbags are not read directly: export their images to a folder first (e.g. with image_view extract_images).
+ */
+
+#include "batchdetector.h"
+#include "cameraparameters.h"
+#include "markerdetector.h"
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Options
+{
+  std::vector<std::string> sources;
+  std::string dictionary = "ARUCO_MIP_36h12";
+  std::string mode = "DM_NORMAL";
+  float minSize = 0;
+  std::string thres = "THRES_ADAPTIVE";
+  std::string camera;
+  float markerSize = -1;
+  int workers = -1;
+  int maxInFlight = 0;
+  std::string format = "csv";
+  std::string output;
+};
+
+const std::pair<const char*, aruco::DetectionMode> detectionModes[] = {
+    {"DM_NORMAL", aruco::DM_NORMAL}, {"DM_FAST", aruco::DM_FAST}, {"DM_VIDEO_FAST", aruco::DM_VIDEO_FAST},
+    {"DM_TRACKING", aruco::DM_TRACKING}};
+
+const std::pair<const char*, aruco::MarkerDetector::ThresMethod> thresMethods[] = {
+    {"THRES_ADAPTIVE", aruco::MarkerDetector::THRES_ADAPTIVE},
+    {"THRES_AUTO_FIXED", aruco::MarkerDetector::THRES_AUTO_FIXED},
+    {"THRES_ADAPTIVE_INTEGRAL", aruco::MarkerDetector::THRES_ADAPTIVE_INTEGRAL}};
+
+template<typename T, std::size_t N>
+bool fromName(const std::pair<const char*, T> (&table)[N], const std::string& name, T& value)
+{
+  for (std::size_t i = 0; i < N; i++)
+    if (name == table[i].first)
+    {
+      value = table[i].second;
+      return true;
+    }
+  std::cerr << "Unknown value " << name << std::endl;
+  return false;
+}
+
+bool parseOptions(int argc, char** argv, Options& opt)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    std::string key = argv[i];
+    if (key == "-h" || key == "--help")
+      return false;
+    if (key.compare(0, 2, "--") != 0)
+    {
+      opt.sources.push_back(key);
+      continue;
+    }
+    if (i + 1 >= argc)
+      return false;
+    std::string value = argv[++i];
+    if (key == "--dictionary")
+      opt.dictionary = value;
+    else if (key == "--mode")
+      opt.mode = value;
+    else if (key == "--min-size")
+      opt.minSize = std::stof(value);
+    else if (key == "--thres")
+      opt.thres = value;
+    else if (key == "--camera")
+      opt.camera = value;
+    else if (key == "--marker-size")
+      opt.markerSize = std::stof(value);
+    else if (key == "--workers")
+      opt.workers = std::stoi(value);
+    else if (key == "--max-in-flight")
+      opt.maxInFlight = std::stoi(value);
+    else if (key == "--format")
+      opt.format = value;
+    else if (key == "--output")
+      opt.output = value;
+    else
+    {
+      std::cerr << "Unknown option " << key << std::endl;
+      return false;
+    }
+  }
+  if (opt.format != "csv" && opt.format != "binary")
+  {
+    std::cerr << "Unknown format " << opt.format << std::endl;
+    return false;
+  }
+  if (opt.format == "binary" && opt.output.empty())
+  {
+    std::cerr << "The binary format must be written to a file (--output)" << std::endl;
+    return false;
+  }
+  return !opt.sources.empty();
+}
+
+// the name between quotes if it has characters that would break the CSV
+std::string csvString(const std::string& str)
+{
+  if (str.find_first_of(",\"\n") == std::string::npos)
+    return str;
+  std::string res = "\"";
+  for (char c : str)
+  {
+    if (c == '"')
+      res += '"';
+    res += c;
+  }
+  return res + "\"";
+}
+
+// the detector sets the pose to -999999 when it has not been estimated
+bool hasPose(const aruco::Marker& m)
+{
+  return m.isPoseValid() && m.Tvec.ptr<float>(0)[2] != -999999;
+}
+
+void writeCsv(std::ostream& out, const aruco::BatchDetector::Result& result)
+{
+  for (const aruco::Marker& m : result.markers)
+  {
+    out << result.sequence << ',' << result.frame << ',' << csvString(result.name) << ',' << m.id;
+    for (const cv::Point2f& p : m)
+      out << ',' << p.x << ',' << p.y;
+    if (hasPose(m))
+      for (int i = 0; i < 6; i++)
+        out << ',' << (i < 3 ? m.Rvec : m.Tvec).ptr<float>(0)[i % 3];
+    else
+      out << ",,,,,,";
+    out << '\n';
+  }
+}
+
+template<typename T>
+void writeValue(std::ostream& out, T value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void writeBinary(std::ostream& out, const aruco::BatchDetector::Result& result)
+{
+  writeValue(out, uint32_t(result.sequence));
+  writeValue(out, uint64_t(result.frame));
+  std::string name = result.name.substr(0, UINT16_MAX);
+  writeValue(out, uint16_t(name.size()));
+  out.write(name.data(), name.size());
+  writeValue(out, uint32_t(result.markers.size()));
+  for (const aruco::Marker& m : result.markers)
+  {
+    writeValue(out, int32_t(m.id));
+    for (const cv::Point2f& p : m)
+    {
+      writeValue(out, p.x);
+      writeValue(out, p.y);
+    }
+    bool pose = hasPose(m);
+    writeValue(out, uint8_t(pose));
+    for (int i = 0; i < 6; i++)
+      writeValue(out, pose ? (i < 3 ? m.Rvec : m.Tvec).ptr<float>(0)[i % 3] : 0.f);
+  }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+  Options opt;
+  aruco::DetectionMode mode;
+  aruco::MarkerDetector::ThresMethod thres;
+  if (!parseOptions(argc, argv, opt) || !fromName(detectionModes, opt.mode, mode)
+      || !fromName(thresMethods, opt.thres, thres))
+  {
+    std::cerr << "Usage: " << argv[0] << " [--dictionary name] [--mode DM_NORMAL] [--min-size fraction]"
+              << " [--thres THRES_ADAPTIVE] [--camera file.yml] [--marker-size meters] [--workers n]"
+              << " [--max-in-flight n] [--format csv|binary] [--output file] <video or folder>..." << std::endl;
+    return 1;
+  }
+
+  try
+  {
+    std::vector<cv::Ptr<aruco::FrameSource>> sources;
+    for (const std::string& path : opt.sources)
+      sources.push_back(aruco::FrameSource::open(path));
+
+    aruco::BatchDetector batch([&](aruco::MarkerDetector& detector)
+    {
+      detector.setDictionary(opt.dictionary);
+      detector.setDetectionMode(mode, opt.minSize);
+      detector.getParameters().setThresholdMethod(thres);
+    }, opt.workers, std::size_t(std::max(0, opt.maxInFlight)));
+    if (!opt.camera.empty())
+    {
+      aruco::CameraParameters camera;
+      camera.readFromXMLFile(opt.camera);
+      batch.setCameraParameters(camera, opt.markerSize);
+    }
+
+    std::ofstream file;
+    if (!opt.output.empty())
+    {
+      file.open(opt.output, opt.format == "binary" ? std::ios::binary : std::ios::out);
+      if (!file)
+        throw cv::Exception(9001, "Could not open " + opt.output, "main", __FILE__, __LINE__);
+    }
+    std::ostream& out = opt.output.empty() ? std::cout : file;
+
+    uint64_t nframes;
+    if (opt.format == "csv")
+    {
+      out << std::setprecision(7) << "sequence,frame,name,id,x0,y0,x1,y1,x2,y2,x3,y3,rx,ry,rz,tx,ty,tz\n";
+      nframes = batch.run(sources, [&out](const aruco::BatchDetector::Result& result)
+      { writeCsv(out, result);});
+    }
+    else
+    {
+      out.write("ARUCOBT1", 8);
+      nframes = batch.run(sources, [&out](const aruco::BatchDetector::Result& result)
+      { writeBinary(out, result);});
+    }
+    out.flush();
+    if (!out)
+      throw cv::Exception(9001, "Error writing the results", "main", __FILE__, __LINE__);
+    std::cerr << nframes << " frames processed" << std::endl;
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,485 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+/**
+ * @file aruco_bench.cpp
+ * @brief Measures the detector under every combination of detection mode, threshold method and number of threads
+ * given, and writes the results as JSON. The frames are either synthetic scenes, rendered with a known pose for each
+ * marker so that the recall can be computed, or the images of a folder, so that the numbers of different machines
+ * can be compared on the same recorded data. For each setting it reports the latency percentiles of the detection and
+ * of each of its stages (the events of the ScopedTimerEvents of the detector), the throughput and the recall.
+ * The stages run by the workers of the detector are recorded too, so with several threads the time of a parallel
+ * stage is the work of all of them added up, and the stages may add up to more than the latency.
+ *
+ * Usage: aruco_bench [options], being the options (default value in brackets):
+ *   --images <dir>        replays the images of the folder instead of rendering synthetic scenes
+ *   --width <1280>, --height <720>, --markers <12>, --noise <2> (std. dev. of the gaussian noise, in grey levels)
+ *   --max-tilt <45>       maximum angle in degrees between the markers and the image plane
+ *   --frames <100>        number of synthetic frames. The markers move slightly from one frame to the next
+ *   --warmup <5>          first frames of each setting that are not measured
+ *   --repeat <1>          passes over the frames
+ *   --seed <1>            seed of the synthetic scenes
+ *   --dictionary <ARUCO_MIP_36h12>
+ *   --modes <DM_NORMAL,DM_FAST,DM_VIDEO_FAST,DM_TRACKING>
+ *   --thres <THRES_ADAPTIVE,THRES_AUTO_FIXED,THRES_ADAPTIVE_INTEGRAL>
+ *   --threads <1,-1>      values of MarkerDetector::Params::maxThreads (-1 means all)
+ *   --max-corner-error <2> distance in pixels below which a marker detected matches the one rendered
+ *   --output <file>       writes the JSON in the file instead of the standard output
+ */
+
+#include "aruco.h"
+#include "timers.h"
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct Options
+{
+  std::string images;
+  int width = 1280, height = 720;
+  int markers = 12;
+  float noise = 2;
+  float maxTilt = 45;
+  int frames = 100;
+  int warmup = 5;
+  int repeat = 1;
+  int seed = 1;
+  std::string dictionary = "ARUCO_MIP_36h12";
+  std::vector<std::string> modes {"DM_NORMAL", "DM_FAST", "DM_VIDEO_FAST", "DM_TRACKING"};
+  std::vector<std::string> thres {"THRES_ADAPTIVE", "THRES_AUTO_FIXED", "THRES_ADAPTIVE_INTEGRAL"};
+  std::vector<std::string> threads {"1", "-1"};
+  float maxCornerError = 2;
+  std::string output;
+};
+
+// a frame and the markers rendered in it, if known
+struct Frame
+{
+  cv::Mat image;
+  std::vector<aruco::Marker> truth;
+};
+
+const std::pair<const char*, aruco::DetectionMode> detectionModes[] = {
+    {"DM_NORMAL", aruco::DM_NORMAL}, {"DM_FAST", aruco::DM_FAST}, {"DM_VIDEO_FAST", aruco::DM_VIDEO_FAST},
+    {"DM_TRACKING", aruco::DM_TRACKING}};
+
+const std::pair<const char*, aruco::MarkerDetector::ThresMethod> thresMethods[] = {
+    {"THRES_ADAPTIVE", aruco::MarkerDetector::THRES_ADAPTIVE},
+    {"THRES_AUTO_FIXED", aruco::MarkerDetector::THRES_AUTO_FIXED},
+    {"THRES_ADAPTIVE_INTEGRAL", aruco::MarkerDetector::THRES_ADAPTIVE_INTEGRAL}};
+
+template<typename T, std::size_t N>
+bool fromName(const std::pair<const char*, T> (&table)[N], const std::string& name, T& value)
+{
+  for (std::size_t i = 0; i < N; i++)
+    if (name == table[i].first)
+    {
+      value = table[i].second;
+      return true;
+    }
+  std::cerr << "Unknown value " << name << std::endl;
+  return false;
+}
+
+std::vector<std::string> split(const std::string& str)
+{
+  std::vector<std::string> items;
+  std::stringstream sstr(str);
+  std::string item;
+  while (std::getline(sstr, item, ','))
+    if (!item.empty())
+      items.push_back(item);
+  return items;
+}
+
+bool parseOptions(int argc, char** argv, Options& opt)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    std::string key = argv[i];
+    if (i + 1 >= argc || key == "-h" || key == "--help")
+      return false;
+    std::string value = argv[++i];
+    if (key == "--images")
+      opt.images = value;
+    else if (key == "--width")
+      opt.width = std::stoi(value);
+    else if (key == "--height")
+      opt.height = std::stoi(value);
+    else if (key == "--markers")
+      opt.markers = std::stoi(value);
+    else if (key == "--noise")
+      opt.noise = std::stof(value);
+    else if (key == "--max-tilt")
+      opt.maxTilt = std::stof(value);
+    else if (key == "--frames")
+      opt.frames = std::stoi(value);
+    else if (key == "--warmup")
+      opt.warmup = std::stoi(value);
+    else if (key == "--repeat")
+      opt.repeat = std::stoi(value);
+    else if (key == "--seed")
+      opt.seed = std::stoi(value);
+    else if (key == "--dictionary")
+      opt.dictionary = value;
+    else if (key == "--modes")
+      opt.modes = split(value);
+    else if (key == "--thres")
+      opt.thres = split(value);
+    else if (key == "--threads")
+      opt.threads = split(value);
+    else if (key == "--max-corner-error")
+      opt.maxCornerError = std::stof(value);
+    else if (key == "--output")
+      opt.output = value;
+    else
+    {
+      std::cerr << "Unknown option " << key << std::endl;
+      return false;
+    }
+  }
+  return opt.width > 0 && opt.height > 0 && opt.markers > 0 && opt.frames > 0 && opt.repeat > 0;
+}
+
+cv::Matx33d rotation(double rx, double ry, double rz)
+{
+  cv::Mat R;
+  cv::Rodrigues(cv::Mat(cv::Vec3d(rx, ry, rz)), R);
+  return cv::Matx33d(R.ptr<double>(0));
+}
+
+/**
+ * Renders a sequence of frames of the markers 0, 1, ... of the dictionary, laid out in a grid. Each marker is tilted
+ * with respect to the image plane, and its pose changes slightly from one frame to the next as in a video.
+ */
+std::vector<Frame> renderScenes(const Options& opt)
+{
+  aruco::Dictionary dict = aruco::Dictionary::loadPredefined(opt.dictionary);
+  if (uint64_t(opt.markers) > dict.size())
+    throw cv::Exception(9001, "The dictionary has not so many markers", "renderScenes", __FILE__, __LINE__);
+
+  cv::RNG rng(opt.seed);
+  const double f = 0.9 * opt.width, cx = opt.width / 2., cy = opt.height / 2.;
+  const cv::Matx33d K(f, 0, cx, 0, f, cy, 0, 0, 1);
+  const double side = 0.1; // in meters, the depth is chosen to get the size in pixels wanted
+  const int bitSize = 10;
+
+  const int cols = static_cast<int>(std::ceil(std::sqrt(double(opt.markers) * opt.width / opt.height)));
+  const int rows = (opt.markers + cols - 1) / cols;
+  const double cell = std::min(double(opt.width) / cols, double(opt.height) / rows);
+
+  struct Placement
+  {
+    cv::Mat image; // with a white border of one bit
+    cv::Point2d center;
+    double sidePix;
+    double tiltAxis, tilt, spin;
+  };
+  std::vector<Placement> placements(opt.markers);
+  for (int i = 0; i < opt.markers; i++)
+  {
+    Placement& p = placements[i];
+    p.image = dict.getMarkerImage_id(i, bitSize, false, false, true);
+    p.center = cv::Point2d((i % cols + 0.5) * opt.width / cols, (i / cols + 0.5) * opt.height / rows);
+    p.sidePix = cell * rng.uniform(0.3, 0.55);
+    p.tiltAxis = rng.uniform(0., CV_PI);
+    p.tilt = rng.uniform(0., opt.maxTilt * CV_PI / 180.);
+    p.spin = rng.uniform(-CV_PI, CV_PI);
+  }
+
+  // background with a smooth illumination change
+  cv::Mat background(opt.height, opt.width, CV_8UC1);
+  for (int y = 0; y < opt.height; y++)
+    for (int x = 0; x < opt.width; x++)
+      background.at<uchar>(y, x) = cv::saturate_cast<uchar>(80 + 100. * x / opt.width + 40. * y / opt.height);
+
+  std::vector<Frame> frames(opt.frames);
+  for (Frame& frame : frames)
+  {
+    cv::Mat scene = background.clone();
+    for (int i = 0; i < opt.markers; i++)
+    {
+      Placement& p = placements[i];
+      p.center += cv::Point2d(rng.gaussian(1.), rng.gaussian(1.));
+      p.spin += rng.gaussian(0.01);
+      p.tilt = std::min(std::max(p.tilt + rng.gaussian(0.01), 0.), opt.maxTilt * CV_PI / 180.);
+
+      cv::Matx33d R = rotation(p.tilt * std::cos(p.tiltAxis), p.tilt * std::sin(p.tiltAxis), 0)
+          * rotation(0, 0, p.spin);
+      double z = f * side / p.sidePix;
+      cv::Vec3d t((p.center.x - cx) * z / f, (p.center.y - cy) * z / f, z);
+
+      // corners of the black square and of the white border, clockwise from the top left one of the marker image
+      const double border = side / 2 * p.image.cols / (p.image.cols - 2. * bitSize);
+      std::vector<cv::Point2f> marker, image;
+      for (int c = 0; c < 4; c++)
+      {
+        double sx = (c == 0 || c == 3) ? -1 : 1, sy = c < 2 ? -1 : 1;
+        cv::Vec3d inner = R * cv::Vec3d(sx * side / 2, sy * side / 2, 0) + t, outer = R
+            * cv::Vec3d(sx * border, sy * border, 0) + t;
+        cv::Vec3d pi = K * inner, po = K * outer;
+        marker.push_back(cv::Point2f(float(pi[0] / pi[2]), float(pi[1] / pi[2])));
+        image.push_back(cv::Point2f(float(po[0] / po[2]), float(po[1] / po[2])));
+      }
+      std::vector<cv::Point2f> source {cv::Point2f(0, 0), cv::Point2f(float(p.image.cols), 0),
+                                       cv::Point2f(float(p.image.cols), float(p.image.rows)),
+                                       cv::Point2f(0, float(p.image.rows))};
+      cv::warpPerspective(p.image, scene, cv::getPerspectiveTransform(source, image), scene.size(), cv::INTER_LINEAR,
+                          cv::BORDER_TRANSPARENT);
+
+      aruco::Marker truth(marker, i);
+      frame.truth.push_back(truth);
+    }
+
+    // optical blur and sensor noise
+    cv::GaussianBlur(scene, scene, cv::Size(3, 3), 0.7);
+    if (opt.noise > 0)
+    {
+      cv::Mat noise(scene.size(), CV_32F);
+      rng.fill(noise, cv::RNG::NORMAL, 0, opt.noise);
+      cv::Mat sceneF;
+      scene.convertTo(sceneF, CV_32F);
+      sceneF += noise;
+      sceneF.convertTo(scene, CV_8U);
+    }
+    frame.image = scene;
+  }
+  return frames;
+}
+
+std::vector<Frame> loadImages(const std::string& folder)
+{
+  std::vector<cv::String> files;
+  cv::glob(folder + "/*", files, false);
+  std::sort(files.begin(), files.end());
+  std::vector<Frame> frames;
+  for (const cv::String& file : files)
+  {
+    Frame frame;
+    frame.image = cv::imread(file, cv::IMREAD_GRAYSCALE);
+    if (!frame.image.empty())
+      frames.push_back(frame);
+  }
+  if (frames.empty())
+    throw cv::Exception(9001, "No images found in " + folder, "loadImages", __FILE__, __LINE__);
+  return frames;
+}
+
+// mean distance of the corners, for the best rotation of the detected ones
+double cornerError(const aruco::Marker& truth, const aruco::Marker& detected)
+{
+  double best = std::numeric_limits<double>::max();
+  for (int r = 0; r < 4; r++)
+  {
+    double sum = 0;
+    for (int c = 0; c < 4; c++)
+      sum += cv::norm(truth[c] - detected[(c + r) % 4]);
+    best = std::min(best, sum / 4);
+  }
+  return best;
+}
+
+std::string jsonString(const std::string& str)
+{
+  std::string out = "\"";
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+      out.push_back('\\');
+    out.push_back(c);
+  }
+  return out + "\"";
+}
+
+// percentiles of the values, in milliseconds
+void writeLatency(std::ostream& out, std::vector<double> values)
+{
+  std::sort(values.begin(), values.end());
+  auto percentile = [&values](double p)
+  { return values.empty() ? 0. : values[std::size_t(p * (values.size() - 1) + 0.5)];};
+  double mean = 0;
+  for (double v : values)
+    mean += v;
+  if (!values.empty())
+    mean /= values.size();
+  out << "{\"mean\": " << mean << ", \"p50\": " << percentile(0.5) << ", \"p90\": " << percentile(0.9)
+      << ", \"p99\": " << percentile(0.99) << ", \"max\": " << percentile(1) << "}";
+}
+
+void runSetting(const std::vector<Frame>& frames, const Options& opt, const std::string& modeName,
+                const std::string& thresName, int threads, std::ostream& out)
+{
+  aruco::DetectionMode mode;
+  aruco::MarkerDetector::ThresMethod thres;
+  if (!fromName(detectionModes, modeName, mode) || !fromName(thresMethods, thresName, thres))
+    throw cv::Exception(9001, "Invalid setting", "runSetting", __FILE__, __LINE__);
+
+  aruco::MarkerDetector detector(opt.dictionary);
+  detector.setDetectionMode(mode);
+  detector.getParameters().setThresholdMethod(thres);
+  detector.getParameters().maxThreads = threads;
+
+  std::vector<double> latency;
+  std::map<std::string, std::vector<double>> stages;
+  std::size_t rendered = 0, found = 0, wrong = 0, detected = 0;
+  double errorSum = 0;
+  std::vector<aruco::Marker> markers;
+  for (int pass = 0; pass < opt.repeat; pass++)
+    for (std::size_t f = 0; f < frames.size(); f++)
+    {
+      aruco::TimerEventsRecorder recorder;
+      auto start = std::chrono::high_resolution_clock::now();
+      detector.detect(frames[f].image, markers);
+      auto end = std::chrono::high_resolution_clock::now();
+      if (pass == 0 && f < std::size_t(opt.warmup))
+        continue;
+
+      latency.push_back(double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / 1e6);
+      // the stages run several times per frame (e.g. once per region) are added up
+      std::map<std::string, double> frameStages;
+      for (const aruco::TimerEventsRecorder::Event& event : recorder.events)
+        frameStages[event.name] += event.ms;
+      for (const auto& stage : frameStages)
+        stages[stage.first].push_back(stage.second);
+
+      detected += markers.size();
+      const std::vector<aruco::Marker>& truth = frames[f].truth;
+      rendered += truth.size();
+      for (const aruco::Marker& m : markers)
+      {
+        auto it = std::find_if(truth.begin(), truth.end(), [&m](const aruco::Marker& t)
+        { return t.id == m.id;});
+        double err = it == truth.end() ? std::numeric_limits<double>::max() : cornerError(*it, m);
+        if (err <= opt.maxCornerError)
+        {
+          found++;
+          errorSum += err;
+        }
+        else if (!truth.empty())
+          wrong++;
+      }
+    }
+
+  double total = 0;
+  for (double v : latency)
+    total += v;
+  out << "    {\"detection_mode\": " << jsonString(modeName) << ", \"thres_method\": " << jsonString(thresName)
+      << ", \"max_threads\": " << threads << ",\n     \"frames\": " << latency.size() << ", \"throughput_fps\": "
+      << (total > 0 ? 1000. * latency.size() / total : 0.) << ", \"markers_per_frame\": "
+      << (latency.empty() ? 0. : double(detected) / latency.size()) << ",\n";
+  if (rendered > 0)
+    out << "     \"recall\": " << double(found) / rendered << ", \"false_detections\": " << wrong
+        << ", \"corner_error_px\": " << (found > 0 ? errorSum / found : 0.) << ",\n";
+  else
+    out << "     \"recall\": null,\n";
+  out << "     \"latency_ms\": ";
+  writeLatency(out, latency);
+  out << ",\n     \"stages_ms\": {";
+  bool first = true;
+  for (const auto& stage : stages)
+  {
+    out << (first ? "\n" : ",\n") << "       " << jsonString(stage.first) << ": ";
+    writeLatency(out, stage.second);
+    first = false;
+  }
+  out << "}}";
+}
+
+}
+
+int main(int argc, char** argv)
+{
+  Options opt;
+  if (!parseOptions(argc, argv, opt))
+  {
+    std::cerr << "Usage: " << argv[0] << " [--images dir] [--width w] [--height h] [--markers n] [--noise sigma]"
+              << " [--max-tilt degrees] [--frames n] [--warmup n] [--repeat n] [--seed n] [--dictionary name]"
+              << " [--modes DM_NORMAL,...] [--thres THRES_ADAPTIVE,...] [--threads 1,-1,...]"
+              << " [--max-corner-error pixels] [--output file.json]" << std::endl;
+    return 1;
+  }
+
+  try
+  {
+    std::vector<Frame> frames = opt.images.empty() ? renderScenes(opt) : loadImages(opt.images);
+
+    std::ofstream file;
+    if (!opt.output.empty())
+    {
+      file.open(opt.output);
+      if (!file)
+        throw cv::Exception(9001, "Could not open " + opt.output, "main", __FILE__, __LINE__);
+    }
+    std::ostream& out = opt.output.empty() ? std::cout : file;
+    out << std::setprecision(6);
+
+    out << "{\n  \"source\": ";
+    if (opt.images.empty())
+      out << "{\"type\": \"synthetic\", \"width\": " << opt.width << ", \"height\": " << opt.height
+          << ", \"markers\": " << opt.markers << ", \"noise\": " << opt.noise << ", \"max_tilt\": " << opt.maxTilt
+          << ", \"seed\": " << opt.seed << ", \"frames\": " << frames.size() << "},\n";
+    else
+      out << "{\"type\": \"images\", \"folder\": " << jsonString(opt.images) << ", \"frames\": " << frames.size()
+          << "},\n";
+    out << "  \"dictionary\": " << jsonString(opt.dictionary) << ", \"warmup\": " << opt.warmup
+        << ", \"repeat\": " << opt.repeat << ",\n  \"results\": [\n";
+
+    bool first = true;
+    for (const std::string& mode : opt.modes)
+      for (const std::string& thres : opt.thres)
+        for (const std::string& threads : opt.threads)
+        {
+          if (!first)
+            out << ",\n";
+          runSetting(frames, opt, mode, thres, std::stoi(threads), out);
+          first = false;
+        }
+    out << "\n  ]\n}" << std::endl;
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << ex.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
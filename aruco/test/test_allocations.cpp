@@ -0,0 +1,203 @@
+/**
+ Copyright 2017 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ */
+/**
+ * @file test_allocations.cpp
+ * @brief Checks that, once the detector has seen a few frames of a given size, detect() does no heap allocations.
+ * Both the allocations through operator new and the buffers of the cv::Mat are counted.
+ *
+ * The OpenCV functions that allocate internally are kept out of the detection measured: OpenCV runs single threaded,
+ * the image is given in grey, it is thresholded with THRES_ADAPTIVE_INTEGRAL (cv::adaptiveThreshold allocates its
+ * mean image) and the corners are not refined (cv::cornerSubPix allocates its window). The markers are small enough
+ * to be read from the full image, so the pyramid is not resized.
+ */
+
+#include "aruco.h"
+
+#include <opencv2/core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+std::atomic<bool> counting(false);
+std::atomic<std::size_t> allocations(0);
+
+void* countedAlloc(std::size_t size)
+{
+  if (counting.load(std::memory_order_relaxed))
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+/**
+ * Counts the buffers of the cv::Mat created while counting, the rest of the work is done by the default allocator
+ */
+class CountingMatAllocator : public cv::MatAllocator
+{
+public:
+  CountingMatAllocator() : _std(cv::Mat::getStdAllocator())
+  {
+  }
+
+  cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step, cv::AccessFlag flags,
+                         cv::UMatUsageFlags usageFlags) const override
+  {
+    if (counting.load(std::memory_order_relaxed) && data == nullptr)
+      allocations.fetch_add(1, std::memory_order_relaxed);
+    return _std->allocate(dims, sizes, type, data, step, flags, usageFlags);
+  }
+
+  bool allocate(cv::UMatData* data, cv::AccessFlag accessflags, cv::UMatUsageFlags usageFlags) const override
+  {
+    return _std->allocate(data, accessflags, usageFlags);
+  }
+
+  void deallocate(cv::UMatData* data) const override
+  {
+    _std->deallocate(data);
+  }
+
+private:
+  cv::MatAllocator* _std;
+};
+
+/**
+ * Frames of 640x480 with a grid of markers of the dictionary, shifted a few pixels from one frame to the next
+ */
+std::vector<cv::Mat> renderFrames(aruco::Dictionary& dict, int nframes)
+{
+  const int bitSize = 6; // 6x6 bits and the black border, 48 pixels a side
+  std::vector<cv::Mat> marker_images;
+  for (int id = 0; id < 6; id++)
+    marker_images.push_back(dict.getMarkerImage_id(id, bitSize, false, false, true));
+
+  std::vector<cv::Mat> frames;
+  for (int f = 0; f < nframes; f++)
+  {
+    cv::Mat frame(480, 640, CV_8UC1, cv::Scalar(255));
+    for (std::size_t i = 0; i < marker_images.size(); i++)
+    {
+      const cv::Mat& image = marker_images[i];
+      cv::Point origin(80 + 200 * (i % 3) + 3 * f, 100 + 200 * (i / 3) + 2 * f);
+      cv::Mat roi = frame(cv::Rect(origin, image.size()));
+      image.copyTo(roi);
+    }
+    frames.push_back(frame);
+  }
+  return frames;
+}
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  void* p = countedAlloc(size);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return countedAlloc(size);
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
+
+TEST(MarkerDetector, NoAllocationsAfterWarmUp)
+{
+  cv::setNumThreads(0);
+  CountingMatAllocator matAllocator;
+  cv::Mat::setDefaultAllocator(&matAllocator);
+
+  aruco::Dictionary dict = aruco::Dictionary::loadPredefined("ARUCO_MIP_36h12");
+  const std::vector<cv::Mat> frames = renderFrames(dict, 4);
+
+  aruco::MarkerDetector detector("ARUCO_MIP_36h12");
+  detector.setDetectionMode(aruco::DM_NORMAL);
+  aruco::MarkerDetector::Params& params = detector.getParameters();
+  params.maxThreads = 1;
+  params.setThresholdMethod(aruco::MarkerDetector::THRES_ADAPTIVE_INTEGRAL);
+  detector.setCornerRefinementSkip([](int) { return true; });
+
+  // the buffers grow to the sizes needed by the frames, and the markers of the output vector get theirs
+  std::vector<aruco::Marker> markers;
+  for (int pass = 0; pass < 2; pass++)
+    for (const cv::Mat& frame : frames)
+      detector.detect(frame, markers);
+  ASSERT_EQ(markers.size(), 6u);
+
+  allocations = 0;
+  counting = true;
+  for (int pass = 0; pass < 5; pass++)
+    for (const cv::Mat& frame : frames)
+      detector.detect(frame, markers);
+  counting = false;
+
+  cv::Mat::setDefaultAllocator(nullptr);
+  EXPECT_EQ(markers.size(), 6u);
+  EXPECT_EQ(allocations.load(), 0u);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -25,6 +25,16 @@ aruco::CameraParameters rosCameraInfo2ArucoCamParams(const sensor_msgs::CameraIn
 tf::Transform arucoMarker2Tf(const aruco::Marker& marker);
 tf2::Transform arucoMarker2Tf2(const aruco::Marker& marker);
 
+/**
+ * @brief toGreyImage gets the grayscale image the detector works on, avoiding the copy and color conversion of
+ *                    cv_bridge::toCvCopy. mono8 images are used in place, bgr8, rgb8, bgra8, rgba8 and 8 bit bayer
+ *                    images are converted with a single cvtColor, and any other encoding goes through cv_bridge.
+ * @param msg input image. The result may point to its data, so it must be kept alive while the result is used
+ * @param buffer storage for the converted image, reused between calls
+ * @return 8 bit single channel image. Do not modify it, since it may be the data of the message
+ */
+cv::Mat toGreyImage(const sensor_msgs::ImageConstPtr& msg, cv::Mat& buffer);
+
 std::vector<aruco::Marker> detectMarkers(const cv::Mat& img,
                                          const aruco::CameraParameters& cam_params,
                                          float marker_size,
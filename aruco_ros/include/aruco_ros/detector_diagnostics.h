@@ -0,0 +1,56 @@
+#ifndef ARUCO_ROS_DETECTOR_DIAGNOSTICS_H
+#define ARUCO_ROS_DETECTOR_DIAGNOSTICS_H
+
+#include <aruco/markerdetector.h>
+#include <ros/ros.h>
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace aruco_ros
+{
+/**
+ * @brief DetectorDiagnostics publishes periodically on /diagnostics a status per detector of the node, with the stats
+ *                            of the frames detected since the previous report (see
+ *                            aruco::MarkerDetector::getFrameStatsHistory): the rate, the latency percentiles of each
+ *                            stage, the mean number of candidates that went through them and the frames dropped.
+ *                            The stats are taken from the thread of a timer, the detection is not slowed down.
+ */
+class DetectorDiagnostics
+{
+public:
+  /**
+   * @param period seconds between reports. Nothing is published if it is not positive
+   */
+  DetectorDiagnostics(ros::NodeHandle& nh, double period);
+
+  /**
+   * @brief add reports the detector in a status with the name given. The detector must outlive this object
+   * @param dropped if given, returns the number of frames dropped for this detector since the start
+   */
+  void add(const std::string& name, const aruco::MarkerDetector& detector,
+           const std::function<uint64_t()>& dropped = std::function<uint64_t()>());
+
+private:
+  struct Source
+  {
+    std::string name;
+    const aruco::MarkerDetector* detector;
+    std::function<uint64_t()> dropped;
+    uint64_t reportedFrame, reportedDrops;
+  };
+
+  void publish(const ros::WallTimerEvent& event);
+
+  std::mutex mutex_;
+  std::vector<Source> sources_;
+  ros::Publisher pub_;
+  ros::WallTimer timer_;
+  ros::WallTime lastReport_;
+};
+
+}
+#endif // ARUCO_ROS_DETECTOR_DIAGNOSTICS_H
@@ -0,0 +1,94 @@
+#ifndef ARUCO_ROS_LATEST_QUEUE_H
+#define ARUCO_ROS_LATEST_QUEUE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace aruco_ros
+{
+/**
+ * @brief LatestQueue connects two stages of a pipeline running in different threads. It holds at most one item:
+ *                    pushing while an item is waiting replaces it, so a slow consumer always gets the most recent
+ *                    data instead of building up latency. The replaced items are counted as dropped.
+ */
+template<typename T>
+class LatestQueue
+{
+public:
+  LatestQueue() :
+      full_(false), closed_(false), dropped_(0)
+  {
+  }
+
+  /**
+   * @brief push stores the item, replacing the one waiting if any
+   * @return false if an item was replaced, or if the queue is closed and the item was discarded
+   */
+  bool push(T item)
+  {
+    bool replaced;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_)
+        return false;
+      replaced = full_;
+      if (replaced)
+        ++dropped_;
+      item_ = std::move(item);
+      full_ = true;
+    }
+    cond_.notify_one();
+    return !replaced;
+  }
+
+  /**
+   * @brief pop waits until there is an item and takes it
+   * @return false if the queue was closed, and then item is not modified
+   */
+  bool pop(T& item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this]
+    { return full_ || closed_;});
+    if (closed_)
+      return false;
+    item = std::move(item_);
+    item_ = T();
+    full_ = false;
+    return true;
+  }
+
+  /**
+   * @brief close discards the item waiting and wakes up the consumer, so that its thread can finish
+   */
+  void close()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      full_ = false;
+      item_ = T();
+    }
+    cond_.notify_all();
+  }
+
+  // number of items replaced before being taken
+  uint64_t dropped() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+  }
+
+private:
+  mutable std::mutex mutex_;
+  std::condition_variable cond_;
+  T item_;
+  bool full_;
+  bool closed_;
+  uint64_t dropped_;
+};
+
+}
+#endif // ARUCO_ROS_LATEST_QUEUE_H
@@ -0,0 +1,55 @@
+#ifndef ARUCO_ROS_TRANSFORM_CACHE_H
+#define ARUCO_ROS_TRANSFORM_CACHE_H
+
+#include <tf/transform_listener.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace aruco_ros
+{
+/**
+ * @brief TransformCache gives the transform between two frames without ever blocking the caller, so it can be
+ *                       called once per image. The latest transform available is looked up in the listener. When
+ *                       it is static (every link of the chain comes from /tf_static), it is kept and the listener is
+ *                       not queried again. When the lookup fails, the last transform known is used, and a thread
+ *                       waits for the transform to become available.
+ */
+class TransformCache
+{
+public:
+  explicit TransformCache(tf::TransformListener& listener);
+  ~TransformCache();
+
+  /**
+   * @brief lookup gets the latest transform of child_frame with respect to reference_frame
+   * @param transform result. It is the identity if both frames are the same
+   * @return false if the transform has never been available. Then transform is not modified
+   */
+  bool lookup(const std::string& reference_frame, const std::string& child_frame, tf::StampedTransform& transform);
+
+  // true if the transform cached is static and no longer looked up
+  bool isStatic() const;
+
+private:
+  // queries the listener without waiting. Must be called with mutex_ locked
+  bool update();
+  void waitLoop();
+
+  tf::TransformListener& listener_;
+  mutable std::mutex mutex_;
+  std::condition_variable cond_;
+  std::thread waitThread_;
+
+  std::string reference_frame_, child_frame_;
+  tf::StampedTransform transform_;
+  bool valid_; // transform_ has been set for the current frames
+  bool static_; // transform_ comes from static transforms only
+  bool waiting_; // the thread has been asked to wait for the transform
+  bool stop_;
+};
+
+}
+#endif // ARUCO_ROS_TRANSFORM_CACHE_H
@@ -5,6 +5,8 @@
 #include <tf/transform_datatypes.h>
 #include <opencv2/calib3d.hpp>
 #include <cv_bridge/cv_bridge.h>
+#include <opencv2/imgproc.hpp>
+#include <sensor_msgs/image_encodings.h>
 
 aruco::CameraParameters aruco_ros::rosCameraInfo2ArucoCamParams(const sensor_msgs::CameraInfo& cam_info,
                                                                 bool useRectifiedParameters)
@@ -87,6 +89,47 @@ tf2::Transform aruco_ros::arucoMarker2Tf2(const aruco::Marker &marker)
 }
 
 
+cv::Mat aruco_ros::toGreyImage(const sensor_msgs::ImageConstPtr& msg, cv::Mat& buffer)
+{
+  namespace enc = sensor_msgs::image_encodings;
+  const std::string& encoding = msg->encoding;
+
+  // conversion code from the encoding of the image, -1 if it is already gray
+  int code;
+  if (encoding == enc::MONO8 || encoding == enc::TYPE_8UC1)
+    code = -1;
+  else if (encoding == enc::BGR8)
+    code = cv::COLOR_BGR2GRAY;
+  else if (encoding == enc::RGB8)
+    code = cv::COLOR_RGB2GRAY;
+  else if (encoding == enc::BGRA8)
+    code = cv::COLOR_BGRA2GRAY;
+  else if (encoding == enc::RGBA8)
+    code = cv::COLOR_RGBA2GRAY;
+  // OpenCV names the bayer patterns by the second row, same as cv_bridge does
+  else if (encoding == enc::BAYER_RGGB8)
+    code = cv::COLOR_BayerBG2GRAY;
+  else if (encoding == enc::BAYER_BGGR8)
+    code = cv::COLOR_BayerRG2GRAY;
+  else if (encoding == enc::BAYER_GBRG8)
+    code = cv::COLOR_BayerGR2GRAY;
+  else if (encoding == enc::BAYER_GRBG8)
+    code = cv::COLOR_BayerGB2GRAY;
+  else
+  {
+    // 16 bit, float... let cv_bridge do the scaling
+    buffer = cv_bridge::toCvCopy(msg, enc::MONO8)->image;
+    return buffer;
+  }
+
+  cv::Mat image(msg->height, msg->width, CV_MAKETYPE(CV_8U, enc::numChannels(encoding)),
+                const_cast<uchar*>(msg->data.data()), msg->step);
+  if (code == -1)
+    return image;
+  cv::cvtColor(image, buffer, code);
+  return buffer;
+}
+
 std::vector<aruco::Marker> aruco_ros::detectMarkers(const cv::Mat &img, const aruco::CameraParameters &cam_params, float marker_size, aruco::MarkerDetector *detector, bool normalize_ilumination, bool correct_fisheye)
 {
   std::vector<aruco::Marker> markers;
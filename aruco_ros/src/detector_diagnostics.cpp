@@ -0,0 +1,101 @@
+#include <aruco_ros/detector_diagnostics.h>
+#include <diagnostic_msgs/DiagnosticArray.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace
+{
+
+diagnostic_msgs::KeyValue keyValue(const std::string& key, double value)
+{
+  std::ostringstream sstr;
+  sstr << std::fixed << std::setprecision(3) << value;
+  diagnostic_msgs::KeyValue kv;
+  kv.key = key;
+  kv.value = sstr.str();
+  return kv;
+}
+
+}
+
+aruco_ros::DetectorDiagnostics::DetectorDiagnostics(ros::NodeHandle& nh, double period) :
+    lastReport_(ros::WallTime::now())
+{
+  if (period <= 0)
+    return;
+  pub_ = nh.advertise<diagnostic_msgs::DiagnosticArray>("/diagnostics", 1);
+  timer_ = nh.createWallTimer(ros::WallDuration(period), &DetectorDiagnostics::publish, this);
+}
+
+void aruco_ros::DetectorDiagnostics::add(const std::string& name, const aruco::MarkerDetector& detector,
+                                         const std::function<uint64_t()>& dropped)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  sources_.push_back(Source {name, &detector, dropped, 0, dropped ? dropped() : 0});
+}
+
+void aruco_ros::DetectorDiagnostics::publish(const ros::WallTimerEvent&)
+{
+  typedef aruco::MarkerDetector::FrameStats FrameStats;
+
+  ros::WallTime now = ros::WallTime::now();
+  double elapsed = (now - lastReport_).toSec();
+  lastReport_ = now;
+
+  diagnostic_msgs::DiagnosticArray msg;
+  msg.header.stamp = ros::Time::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (Source& source : sources_)
+  {
+    // the frames since the previous report. If there were more than the history kept, the last ones are taken
+    std::vector<FrameStats> history = source.detector->getFrameStatsHistory();
+    history.erase(history.begin(), std::find_if(history.begin(), history.end(), [&source](const FrameStats& s)
+    { return s.frame > source.reportedFrame;}));
+    uint64_t frames = history.empty() ? 0 : history.back().frame - source.reportedFrame;
+    if (!history.empty())
+      source.reportedFrame = history.back().frame;
+    uint64_t drops = source.dropped ? source.dropped() : 0;
+    uint64_t dropped = drops - source.reportedDrops;
+    source.reportedDrops = drops;
+
+    diagnostic_msgs::DiagnosticStatus status;
+    status.name = ros::this_node::getName() + ": " + source.name;
+    status.hardware_id = source.name;
+    std::ostringstream message;
+    message << frames << " frames detected";
+    if (dropped > 0)
+      message << ", " << dropped << " dropped";
+    status.level = dropped > 0 ? diagnostic_msgs::DiagnosticStatus::WARN : diagnostic_msgs::DiagnosticStatus::OK;
+    status.message = message.str();
+
+    status.values.push_back(keyValue("rate (Hz)", elapsed > 0 ? frames / elapsed : 0.));
+    status.values.push_back(keyValue("frames dropped", double(dropped)));
+    status.values.push_back(keyValue("frames sampled", double(history.size())));
+    if (!history.empty())
+    {
+      std::vector<double> ms(history.size());
+      for (int stage = 0; stage < FrameStats::NSTAGES; stage++)
+      {
+        for (std::size_t i = 0; i < history.size(); i++)
+          ms[i] = history[i].ms[stage];
+        std::sort(ms.begin(), ms.end());
+        std::string name = FrameStats::stageName(stage);
+        status.values.push_back(keyValue(name + " p50 (ms)", ms[(ms.size() - 1) / 2]));
+        status.values.push_back(keyValue(name + " p90 (ms)", ms[std::size_t(0.9 * (ms.size() - 1) + 0.5)]));
+        status.values.push_back(keyValue(name + " max (ms)", ms.back()));
+      }
+      for (int count = 0; count < FrameStats::NCOUNTS; count++)
+      {
+        double sum = 0;
+        for (const FrameStats& s : history)
+          sum += s.count[count];
+        status.values.push_back(keyValue(std::string(FrameStats::countName(count)) + " (mean)",
+                                         sum / history.size()));
+      }
+    }
+    msg.status.push_back(status);
+  }
+  pub_.publish(msg);
+}
@@ -26,7 +26,10 @@
  or implied, of Rafael Muñoz Salinas.
  ********************************/
 
+#include <atomic>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <aruco/aruco.h>
 #include <aruco/cvdrawingutils.h>
 
@@ -35,24 +38,45 @@
 #include <cv_bridge/cv_bridge.h>
 #include <sensor_msgs/image_encodings.h>
 #include <aruco_ros/aruco_ros_utils.h>
+#include <aruco_ros/detector_diagnostics.h>
+#include <aruco_ros/latest_queue.h>
+#include <aruco_ros/transform_cache.h>
 #include <tf/transform_broadcaster.h>
 #include <tf/transform_listener.h>
 #include <visualization_msgs/Marker.h>
+#include <visualization_msgs/MarkerArray.h>
+#include <aruco_msgs/MarkerArray.h>
 
 #include <dynamic_reconfigure/server.h>
 #include <aruco_ros/ArucoThresholdConfig.h>
 
-class ArucoSimple
+#ifdef ARUCO_ROS_NODELET
+#include <nodelet/nodelet.h>
+#include <pluginlib/class_list_macros.h>
+#endif
+
+class ArucoGrips
 {
 private:
-  cv::Mat inImage;
+  // result of the detection stage, passed to the publishing one with the camera data it was computed with
+  struct Detection
+  {
+    sensor_msgs::ImageConstPtr image;
+    std::vector<aruco::Marker> markers;
+    aruco::CameraParameters camParam;
+    tf::StampedTransform rightToLeft;
+  };
+
+  cv::Mat inImage, greyBuffer;
   aruco::CameraParameters camParam;
   tf::StampedTransform rightToLeft;
   bool useRectifiedImages;
   aruco::MarkerDetector mDetector;
-  std::vector<aruco::Marker> markers;
+  aruco::MultiMarkerPoseTracker poseTracker;
+  bool pose_tracking;
+  std::mutex detectorMutex; // protects mDetector, camParam and rightToLeft, changed from the callbacks
   ros::Subscriber cam_info_sub;
-  bool cam_info_received;
+  std::atomic<bool> cam_info_received;
   image_transport::Publisher image_pub;
   image_transport::Publisher debug_pub;
   ros::Publisher pose_pub;
@@ -60,6 +84,9 @@ private:
   ros::Publisher position_pub;
   ros::Publisher marker_pub; // rviz visualization marker
   ros::Publisher pixel_pub;
+  ros::Publisher markers_pub; // batch output: all the markers of a frame in one message
+  ros::Publisher vis_markers_pub;
+  bool batch_output;
   std::string marker_frame;
   std::string camera_frame;
   std::string reference_frame;
@@ -73,12 +100,23 @@ private:
   image_transport::Subscriber image_sub;
 
   tf::TransformListener _tfListener;
+  aruco_ros::TransformCache cameraToReferenceCache;
 
   dynamic_reconfigure::Server<aruco_ros::ArucoThresholdConfig> dyn_rec_server;
 
+  // pipeline: the image callback only queues the images, the detection and the publishing run in their own threads
+  aruco_ros::LatestQueue<sensor_msgs::ImageConstPtr> images;
+  aruco_ros::LatestQueue<Detection> detections;
+  std::thread detectThread;
+  std::thread publishThread;
+  ros::WallTime lastDropReport;
+  uint64_t reportedImageDrops, reportedDetectionDrops;
+  aruco_ros::DetectorDiagnostics diagnostics;
+
 public:
-  ArucoSimple() :
-      cam_info_received(false), nh("~"), it(nh)
+  explicit ArucoGrips(const ros::NodeHandle& private_nh = ros::NodeHandle("~")) :
+      cam_info_received(false), nh(private_nh), it(nh), cameraToReferenceCache(_tfListener), dyn_rec_server(nh),
+      reportedImageDrops(0), reportedDetectionDrops(0), diagnostics(nh, nh.param("diagnostics_period", 1.0))
   {
 
     if (nh.hasParam("corner_refinement"))
@@ -95,6 +133,9 @@ public:
       case aruco::MarkerDetector::ThresMethod::THRES_AUTO_FIXED:
         thresh_method = "THRESH_AUTO_FIXED";
         break;
+      case aruco::MarkerDetector::ThresMethod::THRES_ADAPTIVE_INTEGRAL:
+        thresh_method = "THRESH_ADAPTIVE_INTEGRAL";
+        break;
       default:
         thresh_method = "UNKNOWN";
         break;
@@ -112,6 +153,8 @@ public:
       mDetector.setDetectionMode(aruco::DM_FAST, min_marker_size);
     else if (detection_mode == "DM_VIDEO_FAST")
       mDetector.setDetectionMode(aruco::DM_VIDEO_FAST, min_marker_size);
+    else if (detection_mode == "DM_TRACKING")
+      mDetector.setDetectionMode(aruco::DM_TRACKING, min_marker_size);
     else
       // Aruco version 2 mode
       mDetector.setDetectionMode(aruco::DM_NORMAL, min_marker_size);
@@ -119,15 +162,25 @@ public:
     ROS_INFO_STREAM("Marker size min: " << min_marker_size << "% of image area");
     ROS_INFO_STREAM("Detection mode: " << detection_mode);
 
-    image_sub = it.subscribe("/image", 1, &ArucoSimple::image_callback, this);
-    cam_info_sub = nh.subscribe("/camera_info", 1, &ArucoSimple::cam_info_callback, this);
+    image_sub = it.subscribe("/image", 1, &ArucoGrips::image_callback, this);
+    cam_info_sub = nh.subscribe("/camera_info", 1, &ArucoGrips::cam_info_callback, this);
 
     image_pub = it.advertise("result", 1);
-    pose_pub = nh.advertise<geometry_msgs::PoseStamped>("pose", 100);
-    transform_pub = nh.advertise<geometry_msgs::TransformStamped>("transform", 100);
-    position_pub = nh.advertise<geometry_msgs::Vector3Stamped>("position", 100);
-    marker_pub = nh.advertise<visualization_msgs::Marker>("marker", 10);
-    pixel_pub = nh.advertise<geometry_msgs::PointStamped>("pixel", 10);
+    // instead of a set of messages per marker, publish one message per frame with all of them
+    nh.param<bool>("batch_output", batch_output, false);
+    if (batch_output)
+    {
+      markers_pub = nh.advertise<aruco_msgs::MarkerArray>("markers", 10);
+      vis_markers_pub = nh.advertise<visualization_msgs::MarkerArray>("marker_array", 10);
+    }
+    else
+    {
+      pose_pub = nh.advertise<geometry_msgs::PoseStamped>("pose", 100);
+      transform_pub = nh.advertise<geometry_msgs::TransformStamped>("transform", 100);
+      position_pub = nh.advertise<geometry_msgs::Vector3Stamped>("position", 100);
+      marker_pub = nh.advertise<visualization_msgs::Marker>("marker", 10);
+      pixel_pub = nh.advertise<geometry_msgs::PointStamped>("pixel", 10);
+    }
 
     nh.param<double>("marker_size", marker_size, 0.05);
     nh.param<int>("marker_id", marker_id, 300);
@@ -135,6 +188,9 @@ public:
     nh.param<std::string>("camera_frame", camera_frame, "");
     nh.param<std::string>("marker_frame", marker_frame, "");
     nh.param<bool>("image_is_rectified", useRectifiedImages, true);
+    // refine the pose of each marker from the previous frame instead of solving it from scratch. Off by default,
+    // since the poses of the ambiguous markers are not the ones of solvePnP then
+    nh.param<bool>("pose_tracking", pose_tracking, false);
     nh.param<std::string>("tf_prefix", tf_prefix, "");
     reference_frame = tf_prefix + reference_frame;
     camera_frame = tf_prefix + camera_frame;
@@ -148,158 +204,259 @@ public:
     ROS_INFO("ArUco node will publish pose to TF with %s as parent and %s as child.", reference_frame.c_str(),
              marker_frame.c_str());
 
-    dyn_rec_server.setCallback(boost::bind(&ArucoSimple::reconf_callback, this, _1, _2));
+    dyn_rec_server.setCallback(boost::bind(&ArucoGrips::reconf_callback, this, _1, _2));
+
+    lastDropReport = ros::WallTime::now();
+    diagnostics.add("detector", mDetector, [this]
+    { return images.dropped() + detections.dropped();});
+    detectThread = std::thread(&ArucoGrips::detectLoop, this);
+    publishThread = std::thread(&ArucoGrips::publishLoop, this);
   }
 
-  bool getTransform(const std::string& refFrame, const std::string& childFrame, tf::StampedTransform& transform)
+  ~ArucoGrips()
   {
-    std::string errMsg;
+    // no callback may run once the members start being destroyed (the subscribers are declared before the queues)
+    image_sub.shutdown();
+    cam_info_sub.shutdown();
+    images.close();
+    detections.close();
+    detectThread.join();
+    publishThread.join();
+  }
 
-    if (!_tfListener.waitForTransform(refFrame, childFrame, ros::Time(0), ros::Duration(0.5), ros::Duration(0.01),
-                                      &errMsg))
-    {
-      ROS_ERROR_STREAM("Unable to get pose from TF: " << errMsg);
-      return false;
-    }
-    else
+  void image_callback(const sensor_msgs::ImageConstPtr& msg)
+  {
+    if (cam_info_received)
+      images.push(msg);
+
+    reportDroppedFrames();
+  }
+
+  // detection stage: takes the latest image, never waits for the previous results to be published
+  void detectLoop()
+  {
+    sensor_msgs::ImageConstPtr msg;
+    while (images.pop(msg))
     {
       try
       {
-        _tfListener.lookupTransform(refFrame, childFrame, ros::Time(0), // get latest available
-                                    transform);
+        Detection detection;
+        detection.image = msg;
+        {
+          std::lock_guard<std::mutex> lock(detectorMutex);
+          detection.camParam = camParam;
+          detection.rightToLeft = rightToLeft;
+          cv::Mat grey = aruco_ros::toGreyImage(msg, greyBuffer);
+          if (pose_tracking)
+          {
+            mDetector.detect(grey, detection.markers);
+            poseTracker.estimatePoses(detection.markers, camParam, grey.size(), marker_size);
+          }
+          else
+            mDetector.detect(grey, detection.markers, camParam, marker_size, false);
+        }
+        detections.push(std::move(detection));
       }
-      catch (const tf::TransformException& e)
+      catch (cv_bridge::Exception& e)
       {
-        ROS_ERROR_STREAM("Error in lookupTransform of " << childFrame << " in " << refFrame);
-        return false;
+        ROS_ERROR("cv_bridge exception: %s", e.what());
       }
-
     }
-    return true;
   }
 
-  void image_callback(const sensor_msgs::ImageConstPtr& msg)
+  // publishing stage: TF lookups, messages and the result image
+  void publishLoop()
   {
-    static tf::TransformBroadcaster br;
-    if (cam_info_received)
+    Detection detection;
+    while (detections.pop(detection))
     {
-      ros::Time curr_stamp = msg->header.stamp;
-      cv_bridge::CvImagePtr cv_ptr;
       try
       {
-        cv_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8);
-        inImage = cv_ptr->image;
-
-        // detection results will go into "markers"
-        markers.clear();
-        // ok, let's detect
-        mDetector.detect(inImage, markers, camParam, marker_size, false);
-        // for each marker, draw info and its boundaries in the image
-        for (std::size_t i = 0; i < markers.size(); ++i)
-        {
-          
-          tf::Transform transform = aruco_ros::arucoMarker2Tf(markers[i]);
-          tf::StampedTransform cameraToReference;
-          cameraToReference.setIdentity();
-
-          //quickfix for aachen - fix wobbeling
-          tf::Quaternion quat = transform.getRotation();
-          double roll, pitch, yaw;
-          tf::Matrix3x3(quat).getRPY(pitch, yaw, roll);
-          
-          ROS_INFO_STREAM("Roll: " << roll << " Pitch: " << pitch << " Yaw: " << yaw);
-
-          tf::Quaternion new_quat;
-          new_quat.setRPY(3.1415f, yaw, 0.0f);
-          transform.setRotation(new_quat);
-
-          if (reference_frame != camera_frame)
-          {
-            getTransform(reference_frame, camera_frame, cameraToReference);
-          }
+        publish(detection);
+      }
+      catch (cv_bridge::Exception& e)
+      {
+        ROS_ERROR("cv_bridge exception: %s", e.what());
+      }
+    }
+  }
 
-          transform = static_cast<tf::Transform>(cameraToReference) * static_cast<tf::Transform>(rightToLeft)
-              * transform;
-
-          std::string grips_marker_frame = tf_prefix + marker_frame + "_" + std::to_string(markers[i].id);
-          tf::StampedTransform stampedTransform(transform, curr_stamp, reference_frame, grips_marker_frame);
-            
-          br.sendTransform(stampedTransform);
-          geometry_msgs::PoseStamped poseMsg;
-
-
-          tf::poseTFToMsg(transform, poseMsg.pose);
-          poseMsg.header.frame_id = reference_frame;
-          poseMsg.header.stamp = curr_stamp;
-
-          pose_pub.publish(poseMsg);
-
-          geometry_msgs::TransformStamped transformMsg;
-          tf::transformStampedTFToMsg(stampedTransform, transformMsg);
-          transform_pub.publish(transformMsg);
-
-          geometry_msgs::Vector3Stamped positionMsg;
-          positionMsg.header = transformMsg.header;
-          positionMsg.vector = transformMsg.transform.translation;
-          position_pub.publish(positionMsg);
-
-          geometry_msgs::PointStamped pixelMsg;
-          pixelMsg.header = transformMsg.header;
-          pixelMsg.point.x = markers[i].getCenter().x;
-          pixelMsg.point.y = markers[i].getCenter().y;
-          pixelMsg.point.z = 0;
-          pixel_pub.publish(pixelMsg);
-
-          // publish rviz marker representing the ArUco marker patch
-          visualization_msgs::Marker visMarker;
-          visMarker.header = transformMsg.header;
-          visMarker.id = 1;
-          visMarker.type = visualization_msgs::Marker::CUBE;
-          visMarker.action = visualization_msgs::Marker::ADD;
-          visMarker.pose = poseMsg.pose;
-          visMarker.scale.x = marker_size;
-          visMarker.scale.y = marker_size;
-          visMarker.scale.z = 0.001;
-          visMarker.color.r = 1.0;
-          visMarker.color.g = 0;
-          visMarker.color.b = 0;
-          visMarker.color.a = 1.0;
-          visMarker.lifetime = ros::Duration(3.0);
-          marker_pub.publish(visMarker);
-
-          markers[i].draw(inImage, cv::Scalar(0, 0, 255), 2);
-        }
+  void publish(const Detection& detection)
+  {
+    static tf::TransformBroadcaster br;
+    const std::vector<aruco::Marker>& markers = detection.markers;
+    ros::Time curr_stamp = detection.image->header.stamp;
+
+    // the color image is only needed to draw on it
+    bool drawImage = image_pub.getNumSubscribers() > 0;
+    if (drawImage)
+      inImage = cv_bridge::toCvCopy(detection.image, sensor_msgs::image_encodings::RGB8)->image;
+    // get the current transform from the camera frame to the reference frame, once for all the markers
+    tf::StampedTransform cameraToReference;
+    cameraToReference.setIdentity();
+    if (!markers.empty())
+      cameraToReferenceCache.lookup(reference_frame, camera_frame, cameraToReference);
+
+    std::vector<tf::StampedTransform> transforms;
+    aruco_msgs::MarkerArray::Ptr markersMsg;
+    visualization_msgs::MarkerArray::Ptr visMarkersMsg;
+    if (batch_output)
+    {
+      transforms.reserve(markers.size());
+      markersMsg.reset(new aruco_msgs::MarkerArray());
+      markersMsg->header.frame_id = reference_frame;
+      markersMsg->header.stamp = curr_stamp;
+      markersMsg->markers.reserve(markers.size());
+      visMarkersMsg.reset(new visualization_msgs::MarkerArray());
+      visMarkersMsg->markers.reserve(markers.size());
+    }
 
-        // draw a 3d cube in each marker if there is 3d info
-        if (camParam.isValid() && marker_size != -1)
+    // for each marker, draw info and its boundaries in the image
+    for (std::size_t i = 0; i < markers.size(); ++i)
+    {
+      tf::Transform transform = aruco_ros::arucoMarker2Tf(markers[i]);
+
+      //quickfix for aachen - fix wobbeling
+      tf::Quaternion quat = transform.getRotation();
+      double roll, pitch, yaw;
+      tf::Matrix3x3(quat).getRPY(pitch, yaw, roll);
+
+      if (!batch_output)
+        ROS_INFO_STREAM("Roll: " << roll << " Pitch: " << pitch << " Yaw: " << yaw);
+
+      tf::Quaternion new_quat;
+      new_quat.setRPY(3.1415f, yaw, 0.0f);
+      transform.setRotation(new_quat);
+
+      transform = static_cast<tf::Transform>(cameraToReference) * static_cast<tf::Transform>(detection.rightToLeft)
+          * transform;
+
+      std::string grips_marker_frame = tf_prefix + marker_frame + "_" + std::to_string(markers[i].id);
+      tf::StampedTransform stampedTransform(transform, curr_stamp, reference_frame, grips_marker_frame);
+
+      // publish rviz marker representing the ArUco marker patch
+      visualization_msgs::Marker visMarker;
+      visMarker.header.frame_id = reference_frame;
+      visMarker.header.stamp = curr_stamp;
+      visMarker.id = 1;
+      visMarker.type = visualization_msgs::Marker::CUBE;
+      visMarker.action = visualization_msgs::Marker::ADD;
+      tf::poseTFToMsg(transform, visMarker.pose);
+      visMarker.scale.x = marker_size;
+      visMarker.scale.y = marker_size;
+      visMarker.scale.z = 0.001;
+      visMarker.color.r = 1.0;
+      visMarker.color.g = 0;
+      visMarker.color.b = 0;
+      visMarker.color.a = 1.0;
+      visMarker.lifetime = ros::Duration(3.0);
+
+      if (batch_output)
+      {
+        transforms.push_back(stampedTransform);
+
+        markersMsg->markers.push_back(aruco_msgs::Marker());
+        aruco_msgs::Marker& markerMsg = markersMsg->markers.back();
+        markerMsg.header = markersMsg->header;
+        markerMsg.id = markers[i].id;
+        markerMsg.pose.pose = visMarker.pose;
+        markerMsg.confidence = 1.0;
+        cv::Point2f center = markers[i].getCenter();
+        markerMsg.pixel_center.x = center.x;
+        markerMsg.pixel_center.y = center.y;
+        for (std::size_t c = 0; c < markers[i].size() && c < markerMsg.pixel_corners.size(); ++c)
         {
-          for (std::size_t i = 0; i < markers.size(); ++i)
-          {
-            aruco::CvDrawingUtils::draw3dAxis(inImage, markers[i], camParam);
-          }
+          markerMsg.pixel_corners[c].x = markers[i][c].x;
+          markerMsg.pixel_corners[c].y = markers[i][c].y;
         }
 
-        if (image_pub.getNumSubscribers() > 0)
-        {
-          // show input with augmented information
-          cv_bridge::CvImage out_msg;
-          out_msg.header.stamp = curr_stamp;
-          out_msg.encoding = sensor_msgs::image_encodings::RGB8;
-          out_msg.image = inImage;
-          image_pub.publish(out_msg.toImageMsg());
-        }
+        // one marker per id, all of them are shown at the same time
+        visMarker.id = markers[i].id;
+        visMarkersMsg->markers.push_back(visMarker);
       }
-      catch (cv_bridge::Exception& e)
+      else
       {
-        ROS_ERROR("cv_bridge exception: %s", e.what());
-        return;
+        br.sendTransform(stampedTransform);
+
+        geometry_msgs::PoseStamped poseMsg;
+        poseMsg.pose = visMarker.pose;
+        poseMsg.header = visMarker.header;
+        pose_pub.publish(poseMsg);
+
+        geometry_msgs::TransformStamped transformMsg;
+        tf::transformStampedTFToMsg(stampedTransform, transformMsg);
+        transform_pub.publish(transformMsg);
+
+        geometry_msgs::Vector3Stamped positionMsg;
+        positionMsg.header = transformMsg.header;
+        positionMsg.vector = transformMsg.transform.translation;
+        position_pub.publish(positionMsg);
+
+        geometry_msgs::PointStamped pixelMsg;
+        pixelMsg.header = transformMsg.header;
+        pixelMsg.point.x = markers[i].getCenter().x;
+        pixelMsg.point.y = markers[i].getCenter().y;
+        pixelMsg.point.z = 0;
+        pixel_pub.publish(pixelMsg);
+
+        marker_pub.publish(visMarker);
+      }
+
+      if (drawImage)
+        markers[i].draw(inImage, cv::Scalar(0, 0, 255), 2);
+    }
+
+    if (batch_output)
+    {
+      if (!transforms.empty())
+        br.sendTransform(transforms);
+      markers_pub.publish(markersMsg);
+      if (!visMarkersMsg->markers.empty())
+        vis_markers_pub.publish(visMarkersMsg);
+    }
+
+    // draw a 3d cube in each marker if there is 3d info
+    if (drawImage && detection.camParam.isValid() && marker_size != -1)
+    {
+      for (std::size_t i = 0; i < markers.size(); ++i)
+      {
+        aruco::CvDrawingUtils::draw3dAxis(inImage, markers[i], detection.camParam);
       }
     }
+
+    if (drawImage)
+    {
+      // show input with augmented information
+      cv_bridge::CvImage out_msg;
+      out_msg.header.stamp = curr_stamp;
+      out_msg.encoding = sensor_msgs::image_encodings::RGB8;
+      out_msg.image = inImage;
+      image_pub.publish(out_msg.toImageMsg());
+    }
+  }
+
+  // reports periodically the frames that were replaced in the queues because a stage was still busy
+  void reportDroppedFrames()
+  {
+    ros::WallTime now = ros::WallTime::now();
+    double elapsed = (now - lastDropReport).toSec();
+    if (elapsed < 10.0)
+      return;
+
+    uint64_t imageDrops = images.dropped(), detectionDrops = detections.dropped();
+    if (imageDrops != reportedImageDrops || detectionDrops != reportedDetectionDrops)
+      ROS_INFO_STREAM("In the last " << elapsed << " s, dropped " << imageDrops - reportedImageDrops
+                      << " images waiting for detection and " << detectionDrops - reportedDetectionDrops
+                      << " detections waiting to be published");
+    reportedImageDrops = imageDrops;
+    reportedDetectionDrops = detectionDrops;
+    lastDropReport = now;
   }
 
   // wait for one camerainfo, then shut down that subscriber
   void cam_info_callback(const sensor_msgs::CameraInfo &msg)
   {
+    std::lock_guard<std::mutex> lock(detectorMutex);
     camParam = aruco_ros::rosCameraInfo2ArucoCamParams(msg, useRectifiedImages);
     
     // handle cartesian offset between stereo pairs
@@ -313,6 +470,7 @@ public:
 
   void reconf_callback(aruco_ros::ArucoThresholdConfig &config, uint32_t level)
   {
+    std::lock_guard<std::mutex> lock(detectorMutex);
     mDetector.setDetectionMode(aruco::DetectionMode(config.detection_mode), config.min_image_size);
     if (config.normalizeImage)
     {
@@ -321,11 +479,33 @@ public:
   }
 };
 
+#ifdef ARUCO_ROS_NODELET
+namespace aruco_ros
+{
+
+class GripsNodelet : public nodelet::Nodelet
+{
+  boost::shared_ptr<ArucoGrips> node_;
+
+  void onInit()
+  {
+    node_.reset(new ArucoGrips(getPrivateNodeHandle()));
+  }
+};
+
+}
+
+PLUGINLIB_EXPORT_CLASS(aruco_ros::GripsNodelet, nodelet::Nodelet)
+#else
 int main(int argc, char **argv)
 {
   ros::init(argc, argv, "aruco_simple");
 
-  ArucoSimple node;
+  ArucoGrips node;
 
-  ros::spin();
+  // the image callback only queues the images, the other callbacks do not have to wait for it
+  ros::AsyncSpinner spinner(2);
+  spinner.start();
+  ros::waitForShutdown();
 }
+#endif
@@ -0,0 +1,272 @@
+/*****************************
+ Copyright 2011 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ ********************************/
+/**
+ * @file marker_map_publish.cpp
+ * @brief Localizes the camera with respect to a map of markers (a MarkerMap file) and publishes its pose
+ */
+
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <aruco/aruco.h>
+#include <aruco/cvdrawingutils.h>
+#include <aruco/markermap.h>
+
+#include <ros/ros.h>
+#include <image_transport/image_transport.h>
+#include <cv_bridge/cv_bridge.h>
+#include <sensor_msgs/image_encodings.h>
+#include <aruco_ros/aruco_ros_utils.h>
+#include <aruco_ros/detector_diagnostics.h>
+#include <aruco_ros/latest_queue.h>
+#include <geometry_msgs/PoseStamped.h>
+#include <tf/transform_broadcaster.h>
+
+#ifdef ARUCO_ROS_NODELET
+#include <nodelet/nodelet.h>
+#include <pluginlib/class_list_macros.h>
+#endif
+
+class ArucoMarkerMapPublisher
+{
+private:
+  // ArUco stuff
+  aruco::MarkerDetector mDetector_;
+  std::string mapFile_;
+  aruco::CameraParameters camParam_;
+  aruco::MarkerMap markerMap_;
+  aruco::MarkerMapPoseTracker mapTracker_;
+  std::vector<aruco::Marker> markers_;
+
+  // node params
+  bool useRectifiedImages_;
+  bool publishTf_;
+  std::string camera_frame_;
+  std::string map_frame_;
+  double marker_size_;
+  float axisSize_;
+
+  // ROS pub-sub
+  ros::NodeHandle nh_;
+  image_transport::ImageTransport it_;
+  image_transport::Subscriber image_sub_;
+  ros::Subscriber cam_info_sub_;
+  image_transport::Publisher image_pub_;
+  ros::Publisher pose_pub_;
+  tf::TransformBroadcaster br_;
+
+  cv::Mat inImage_, greyBuffer_;
+
+  // the image callback only queues the images, the detection runs in its own thread
+  aruco_ros::LatestQueue<sensor_msgs::ImageConstPtr> images_;
+  std::thread detectThread_;
+  aruco_ros::DetectorDiagnostics diagnostics_;
+  // the tracker is set up with the first camera info, and then the images are subscribed to
+  std::mutex initMutex_;
+  bool initialized_ = false;
+
+public:
+  explicit ArucoMarkerMapPublisher(const ros::NodeHandle& private_nh = ros::NodeHandle("~")) :
+      nh_(private_nh), it_(nh_), diagnostics_(nh_, nh_.param("diagnostics_period", 1.0))
+  {
+    // with wrong params the instance does nothing, but it does not shut down the process, that may be a nodelet
+    // manager running other nodelets
+    std::string dictionary;
+    if (!nh_.getParam("map_file", mapFile_))
+    {
+      ROS_ERROR("The marker map to localize the camera in must be given in param map_file");
+      return;
+    }
+    nh_.param<double>("marker_size", marker_size_, -1); // only needed if the map is expressed in pixels
+    nh_.param<bool>("image_is_rectified", useRectifiedImages_, true);
+    nh_.param<bool>("publish_tf", publishTf_, true);
+    nh_.param<std::string>("camera_frame", camera_frame_, "");
+    nh_.param<std::string>("map_frame", map_frame_, "marker_map");
+
+    try
+    {
+      markerMap_.readFromFile(mapFile_);
+      if (markerMap_.isExpressedInMeters())
+        axisSize_ = markerMap_.empty() ? 0 : 2 * markerMap_[0].getMarkerSize();
+      else
+        axisSize_ = 2 * marker_size_;
+    }
+    catch (const cv::Exception& e)
+    {
+      ROS_ERROR_STREAM("Unable to read the marker map " << mapFile_ << ": " << e.what());
+      return;
+    }
+    // the map tells the dictionary of its markers, unless it is given explicitly
+    nh_.param<std::string>("dictionary", dictionary, markerMap_.getDictionary());
+    if (!dictionary.empty())
+      mDetector_.setDictionary(dictionary);
+    // the relocalization runs in the workers of the detector, which are idle at that point
+    mapTracker_.setThreadPool(mDetector_.getThreadPool());
+
+    image_pub_ = it_.advertise("result", 1);
+    pose_pub_ = nh_.advertise<geometry_msgs::PoseStamped>("camera_pose", 100);
+
+    diagnostics_.add("detector", mDetector_, [this]
+    { return images_.dropped();});
+
+    cam_info_sub_ = nh_.subscribe("/camera_info", 1, &ArucoMarkerMapPublisher::cam_info_callback, this);
+  }
+
+  ~ArucoMarkerMapPublisher()
+  {
+    {
+      // no detection thread can be started once the destruction begins
+      std::lock_guard<std::mutex> lock(initMutex_);
+      initialized_ = true;
+      cam_info_sub_.shutdown();
+    }
+    images_.close();
+    if (detectThread_.joinable())
+      detectThread_.join();
+  }
+
+  void cam_info_callback(const sensor_msgs::CameraInfo& msg)
+  {
+    std::lock_guard<std::mutex> lock(initMutex_);
+    if (initialized_)
+      return;
+    initialized_ = true;
+    cam_info_sub_.shutdown();
+
+    camParam_ = aruco_ros::rosCameraInfo2ArucoCamParams(msg, useRectifiedImages_);
+    if (camera_frame_.empty())
+      camera_frame_ = msg.header.frame_id;
+    try
+    {
+      mapTracker_.setParams(camParam_, markerMap_, marker_size_);
+    }
+    catch (const cv::Exception& e)
+    {
+      ROS_ERROR_STREAM("Unable to use the marker map " << mapFile_ << ": " << e.what());
+      return;
+    }
+
+    // the detection thread starts once the tracker is ready, so it does not need to lock it
+    image_sub_ = it_.subscribe("/image", 1, &ArucoMarkerMapPublisher::image_callback, this);
+    detectThread_ = std::thread(&ArucoMarkerMapPublisher::detectLoop, this);
+  }
+
+  void image_callback(const sensor_msgs::ImageConstPtr& msg)
+  {
+    if (publishTf_ || pose_pub_.getNumSubscribers() > 0 || image_pub_.getNumSubscribers() > 0)
+      images_.push(msg);
+  }
+
+  void detectLoop()
+  {
+    sensor_msgs::ImageConstPtr msg;
+    while (images_.pop(msg))
+    {
+      try
+      {
+        mDetector_.detect(aruco_ros::toGreyImage(msg, greyBuffer_), markers_);
+        bool localized = mapTracker_.estimatePose(markers_);
+        publish(msg, localized);
+      }
+      catch (cv_bridge::Exception& e)
+      {
+        ROS_ERROR("cv_bridge exception: %s", e.what());
+      }
+    }
+  }
+
+  void publish(const sensor_msgs::ImageConstPtr& msg, bool localized)
+  {
+    ros::Time curr_stamp = msg->header.stamp;
+    if (localized)
+    {
+      // the tracker gives the pose of the map in the camera, the same way the markers are published
+      aruco::Marker mapPose;
+      mapPose.Rvec = mapTracker_.getRvec();
+      mapPose.Tvec = mapTracker_.getTvec();
+      tf::Transform transform = aruco_ros::arucoMarker2Tf(mapPose);
+
+      if (publishTf_)
+        br_.sendTransform(tf::StampedTransform(transform, curr_stamp, camera_frame_, map_frame_));
+
+      geometry_msgs::PoseStamped poseMsg;
+      tf::poseTFToMsg(transform.inverse(), poseMsg.pose);
+      poseMsg.header.frame_id = map_frame_;
+      poseMsg.header.stamp = curr_stamp;
+      pose_pub_.publish(poseMsg);
+    }
+
+    // publish input image with the markers and the axis of the map drawn on it
+    if (image_pub_.getNumSubscribers() > 0)
+    {
+      inImage_ = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8)->image;
+      for (std::size_t i = 0; i < markers_.size(); ++i)
+        markers_[i].draw(inImage_, cv::Scalar(0, 0, 255), 2);
+      if (localized)
+        aruco::CvDrawingUtils::draw3dAxis(inImage_, camParam_, mapTracker_.getRvec(), mapTracker_.getTvec(),
+                                          axisSize_);
+
+      cv_bridge::CvImage out_msg;
+      out_msg.header.stamp = curr_stamp;
+      out_msg.encoding = sensor_msgs::image_encodings::RGB8;
+      out_msg.image = inImage_;
+      image_pub_.publish(out_msg.toImageMsg());
+    }
+  }
+};
+
+#ifdef ARUCO_ROS_NODELET
+namespace aruco_ros
+{
+
+class MarkerMapPublisherNodelet : public nodelet::Nodelet
+{
+  boost::shared_ptr<ArucoMarkerMapPublisher> node_;
+
+  void onInit()
+  {
+    node_.reset(new ArucoMarkerMapPublisher(getPrivateNodeHandle()));
+  }
+};
+
+}
+
+PLUGINLIB_EXPORT_CLASS(aruco_ros::MarkerMapPublisherNodelet, nodelet::Nodelet)
+#else
+int main(int argc, char **argv)
+{
+  ros::init(argc, argv, "aruco_marker_map_publisher");
+
+  ArucoMarkerMapPublisher node;
+
+  // the image callback only queues the images, the other callbacks do not have to wait for it
+  ros::AsyncSpinner spinner(2);
+  spinner.start();
+  ros::waitForShutdown();
+}
+#endif
@@ -33,7 +33,9 @@
  * (modified by Josh Langsfeld, 2014)
  */
 
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include <aruco/aruco.h>
 #include <aruco/cvdrawingutils.h>
 
@@ -42,17 +44,33 @@
 #include <cv_bridge/cv_bridge.h>
 #include <sensor_msgs/image_encodings.h>
 #include <aruco_ros/aruco_ros_utils.h>
+#include <aruco_ros/detector_diagnostics.h>
+#include <aruco_ros/latest_queue.h>
+#include <aruco_ros/transform_cache.h>
 #include <aruco_msgs/MarkerArray.h>
 #include <tf/transform_listener.h>
 #include <std_msgs/UInt32MultiArray.h>
 
+#ifdef ARUCO_ROS_NODELET
+#include <nodelet/nodelet.h>
+#include <pluginlib/class_list_macros.h>
+#endif
+
 class ArucoMarkerPublisher
 {
 private:
+  // result of the detection stage, passed to the publishing one
+  struct Detection
+  {
+    sensor_msgs::ImageConstPtr image;
+    std::vector<aruco::Marker> markers;
+    cv::Mat thresholded; // only filled if the debug image is published
+  };
+
   // ArUco stuff
   aruco::MarkerDetector mDetector_;
   aruco::CameraParameters camParam_;
-  std::vector<aruco::Marker> markers_;
+  aruco::MultiMarkerPoseTracker poseTracker_;
 
   // node params
   bool useRectifiedImages_;
@@ -60,6 +78,7 @@ private:
   std::string camera_frame_;
   std::string reference_frame_;
   double marker_size_;
+  bool usePoseTracking_;
 
   // custom param
   bool empty_published_;
@@ -74,29 +93,41 @@ private:
   ros::Publisher marker_pub_;
   ros::Publisher marker_list_pub_;
   tf::TransformListener tfListener_;
+  aruco_ros::TransformCache cameraToReferenceCache_;
 
   ros::Subscriber cam_info_sub_;
+  // the images are only queued once camParam_ is set, in the first camera info (if it is used)
+  std::atomic<bool> cam_info_received_;
   aruco_msgs::MarkerArray::Ptr marker_msg_;
-  cv::Mat inImage_;
+  cv::Mat inImage_, greyBuffer_;
   bool useCamInfo_;
   std_msgs::UInt32MultiArray marker_list_msg_;
 
+  // pipeline: the image callback only queues the images, the detection and the publishing run in their own threads
+  aruco_ros::LatestQueue<sensor_msgs::ImageConstPtr> images_;
+  aruco_ros::LatestQueue<Detection> detections_;
+  std::thread detectThread_;
+  std::thread publishThread_;
+  ros::WallTime lastDropReport_;
+  uint64_t reportedImageDrops_, reportedDetectionDrops_;
+  aruco_ros::DetectorDiagnostics diagnostics_;
+
 public:
-  ArucoMarkerPublisher() :
-      nh_("~"), it_(nh_), useCamInfo_(true)
+  explicit ArucoMarkerPublisher(const ros::NodeHandle& private_nh = ros::NodeHandle("~")) :
+      nh_(private_nh), it_(nh_), cameraToReferenceCache_(tfListener_), cam_info_received_(false), useCamInfo_(true),
+      reportedImageDrops_(0),
+      reportedDetectionDrops_(0), diagnostics_(nh_, nh_.param("diagnostics_period", 1.0))
   {
-    image_sub_ = it_.subscribe("/image", 1, &ArucoMarkerPublisher::image_callback, this);
-
     nh_.param<bool>("use_camera_info", useCamInfo_, true);
+    // refine the pose of each marker from the previous frame instead of solving it from scratch. Off by default,
+    // since the poses of the ambiguous markers are not the ones of solvePnP then
+    nh_.param<bool>("pose_tracking", usePoseTracking_, false);
     if (useCamInfo_)
     {
-      sensor_msgs::CameraInfoConstPtr msg = ros::topic::waitForMessage<sensor_msgs::CameraInfo>("/camera_info", nh_); //, 10.0);
-
       nh_.param<double>("marker_size", marker_size_, 0.05);
       nh_.param<bool>("image_is_rectified", useRectifiedImages_, true);
       nh_.param<std::string>("reference_frame", reference_frame_, "");
       nh_.param<std::string>("camera_frame", camera_frame_, "");
-      camParam_ = aruco_ros::rosCameraInfo2ArucoCamParams(*msg, useRectifiedImages_);
       ROS_ASSERT(not (camera_frame_.empty() and not reference_frame_.empty()));
       if (reference_frame_.empty())
         reference_frame_ = camera_frame_;
@@ -104,6 +135,7 @@ public:
     else
     {
       camParam_ = aruco::CameraParameters();
+      cam_info_received_ = true;
     }
 
     image_pub_ = it_.advertise("result", 1);
@@ -116,167 +148,251 @@ public:
     marker_msg_->header.seq = 0;
 
     empty_published_ = false;
+
+    lastDropReport_ = ros::WallTime::now();
+    diagnostics_.add("detector", mDetector_, [this]
+    { return images_.dropped() + detections_.dropped();});
+    detectThread_ = std::thread(&ArucoMarkerPublisher::detectLoop, this);
+    publishThread_ = std::thread(&ArucoMarkerPublisher::publishLoop, this);
+
+    // the camera info is not waited for here, so that loading the nodelet does not block the manager (e.g. until
+    // the camera driver, loaded afterwards in the same manager, publishes it)
+    image_sub_ = it_.subscribe("/image", 1, &ArucoMarkerPublisher::image_callback, this);
+    if (useCamInfo_)
+      cam_info_sub_ = nh_.subscribe("/camera_info", 1, &ArucoMarkerPublisher::cam_info_callback, this);
+  }
+
+  ~ArucoMarkerPublisher()
+  {
+    // no callback may run once the members start being destroyed (the subscribers are declared before the queues)
+    image_sub_.shutdown();
+    cam_info_sub_.shutdown();
+    images_.close();
+    detections_.close();
+    detectThread_.join();
+    publishThread_.join();
+  }
+
+  void image_callback(const sensor_msgs::ImageConstPtr& msg)
+  {
+    bool publishMarkers = marker_pub_.getNumSubscribers() > 0;
+    bool publishMarkersList = marker_list_pub_.getNumSubscribers() > 0;
+    bool publishImage = image_pub_.getNumSubscribers() > 0;
+
+    if (cam_info_received_ && (publishMarkers || publishMarkersList || publishImage))
+      images_.push(msg);
+
+    reportDroppedFrames();
   }
 
-  bool getTransform(const std::string& refFrame, const std::string& childFrame, tf::StampedTransform& transform)
+  // the first message gives the camera parameters, read by the detection thread once images are queued
+  void cam_info_callback(const sensor_msgs::CameraInfo &msg)
   {
-    std::string errMsg;
+    if (cam_info_received_)
+      return;
+    camParam_ = aruco_ros::rosCameraInfo2ArucoCamParams(msg, useRectifiedImages_);
+    cam_info_received_ = true;
+    cam_info_sub_.shutdown();
+  }
 
-    if (!tfListener_.waitForTransform(refFrame, childFrame, ros::Time(0), ros::Duration(0.5), ros::Duration(0.01),
-                                      &errMsg))
+  // detection stage: takes the latest image, never waits for the previous results to be published
+  void detectLoop()
+  {
+    sensor_msgs::ImageConstPtr msg;
+    while (images_.pop(msg))
     {
-      ROS_ERROR_STREAM("Unable to get pose from TF: " << errMsg);
-      return false;
+      bool publishDebug = false;
+      try
+      {
+        Detection detection;
+        detection.image = msg;
+        cv::Mat grey = aruco_ros::toGreyImage(msg, greyBuffer_);
+        if (usePoseTracking_)
+        {
+          mDetector_.detect(grey, detection.markers);
+          poseTracker_.estimatePoses(detection.markers, camParam_, grey.size(), marker_size_);
+        }
+        else
+          mDetector_.detect(grey, detection.markers, camParam_, marker_size_, false);
+        // the thresholded image is overwritten by the next detection, so the publishing stage needs its own copy
+        if (publishDebug)
+          detection.thresholded = mDetector_.getThresholdedImage().clone();
+        detections_.push(std::move(detection));
+      }
+      catch (cv_bridge::Exception& e)
+      {
+        ROS_ERROR("cv_bridge exception: %s", e.what());
+      }
     }
-    else
+  }
+
+  // publishing stage: TF lookups, messages and the result image
+  void publishLoop()
+  {
+    Detection detection;
+    while (detections_.pop(detection))
     {
       try
       {
-        tfListener_.lookupTransform(refFrame, childFrame, ros::Time(0), // get latest available
-                                    transform);
+        publish(detection);
       }
-      catch (const tf::TransformException& e)
+      catch (cv_bridge::Exception& e)
       {
-        ROS_ERROR_STREAM("Error in lookupTransform of " << childFrame << " in " << refFrame);
-        return false;
+        ROS_ERROR("cv_bridge exception: %s", e.what());
       }
-
     }
-    return true;
   }
 
-  void image_callback(const sensor_msgs::ImageConstPtr& msg)
+  void publish(const Detection& detection)
   {
+    const std::vector<aruco::Marker>& markers = detection.markers;
     bool publishMarkers = marker_pub_.getNumSubscribers() > 0;
     bool publishMarkersList = marker_list_pub_.getNumSubscribers() > 0;
     bool publishImage = image_pub_.getNumSubscribers() > 0;
-    bool publishDebug = false;
+    ros::Time curr_stamp = detection.image->header.stamp;
 
-    if (!publishMarkers && !publishMarkersList && !publishImage && !publishDebug)
-      return;
-
-    ros::Time curr_stamp = msg->header.stamp;
-    cv_bridge::CvImagePtr cv_ptr;
-    try
+    // marker array publish
+    if (publishMarkers)
     {
-      cv_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8);
-      inImage_ = cv_ptr->image;
-
-      // clear out previous detection results
-      markers_.clear();
+      marker_msg_->markers.clear();
+      marker_msg_->markers.resize(markers.size());
+      marker_msg_->header.stamp = curr_stamp;
+      marker_msg_->header.seq++;
 
-      // ok, let's detect
-      mDetector_.detect(inImage_, markers_, camParam_, marker_size_, false);
+      for (std::size_t i = 0; i < markers.size(); ++i)
+      {
+        aruco_msgs::Marker & marker_i = marker_msg_->markers.at(i);
+        marker_i.header.stamp = curr_stamp;
+        marker_i.id = markers.at(i).id;
+        marker_i.confidence = 1.0;
+      }
 
-      // marker array publish
-      if (publishMarkers)
+      // if there is camera info let's do 3D stuff
+      if (useCamInfo_)
       {
-        marker_msg_->markers.clear();
-        marker_msg_->markers.resize(markers_.size());
-        marker_msg_->header.stamp = curr_stamp;
-        marker_msg_->header.seq++;
+        // get the current transform from the camera frame to output ref frame, once for all the markers
+        tf::StampedTransform cameraToReference;
+        cameraToReference.setIdentity();
+        cameraToReferenceCache_.lookup(reference_frame_, camera_frame_, cameraToReference);
 
-        for (std::size_t i = 0; i < markers_.size(); ++i)
+        // now find the transform for each detected marker
+        for (std::size_t i = 0; i < markers.size(); ++i)
         {
           aruco_msgs::Marker & marker_i = marker_msg_->markers.at(i);
-          marker_i.header.stamp = curr_stamp;
-          marker_i.id = markers_.at(i).id;
-          marker_i.confidence = 1.0;
-        }
-
-        // if there is camera info let's do 3D stuff
-        if (useCamInfo_)
-        {
-          // get the current transform from the camera frame to output ref frame
-          tf::StampedTransform cameraToReference;
-          cameraToReference.setIdentity();
-
-          if (reference_frame_ != camera_frame_)
-          {
-            getTransform(reference_frame_, camera_frame_, cameraToReference);
-          }
-
-          // now find the transform for each detected marker
-          for (std::size_t i = 0; i < markers_.size(); ++i)
-          {
-            aruco_msgs::Marker & marker_i = marker_msg_->markers.at(i);
-            tf::Transform transform = aruco_ros::arucoMarker2Tf(markers_[i]);
-            transform = static_cast<tf::Transform>(cameraToReference) * transform;
-            tf::poseTFToMsg(transform, marker_i.pose.pose);
-            marker_i.header.frame_id = reference_frame_;
-          }
-        }
-
-        // publish marker array
-        if (marker_msg_->markers.size() > 0)
-        {
-          empty_published_ = false;
-          marker_pub_.publish(marker_msg_);
-        }
-        if(!empty_published_) 
-        {
-          marker_pub_.publish(marker_msg_);
-          empty_published_ = true;
+          tf::Transform transform = aruco_ros::arucoMarker2Tf(markers[i]);
+          transform = static_cast<tf::Transform>(cameraToReference) * transform;
+          tf::poseTFToMsg(transform, marker_i.pose.pose);
+          marker_i.header.frame_id = reference_frame_;
         }
       }
 
-      if (publishMarkersList)
+      // publish marker array
+      if (marker_msg_->markers.size() > 0)
       {
-        marker_list_msg_.data.resize(markers_.size());
-        for (std::size_t i = 0; i < markers_.size(); ++i)
-          marker_list_msg_.data[i] = markers_[i].id;
-
-        marker_list_pub_.publish(marker_list_msg_);
+        empty_published_ = false;
+        marker_pub_.publish(marker_msg_);
       }
-
-      // draw detected markers on the image for visualization
-      for (std::size_t i = 0; i < markers_.size(); ++i)
+      if(!empty_published_) 
       {
-        markers_[i].draw(inImage_, cv::Scalar(0, 0, 255), 2);
+        marker_pub_.publish(marker_msg_);
+        empty_published_ = true;
       }
+    }
 
-      // draw a 3D cube in each marker if there is 3D info
-      if (camParam_.isValid() && marker_size_ != -1)
-      {
-        for (std::size_t i = 0; i < markers_.size(); ++i)
-          aruco::CvDrawingUtils::draw3dAxis(inImage_, markers_[i], camParam_);
-      }
+    if (publishMarkersList)
+    {
+      marker_list_msg_.data.resize(markers.size());
+      for (std::size_t i = 0; i < markers.size(); ++i)
+        marker_list_msg_.data[i] = markers[i].id;
+
+      marker_list_pub_.publish(marker_list_msg_);
+    }
 
-      // publish input image with markers drawn on it
-      if (publishImage)
+    // publish input image with markers drawn on it
+    if (publishImage)
+    {
+      // the color copy is only made if somebody is going to see it
+      inImage_ = cv_bridge::toCvCopy(detection.image, sensor_msgs::image_encodings::RGB8)->image;
+
+      // draw detected markers on the image for visualization
+      for (std::size_t i = 0; i < markers.size(); ++i)
       {
-        // show input with augmented information
-        cv_bridge::CvImage out_msg;
-        out_msg.header.stamp = curr_stamp;
-        out_msg.encoding = sensor_msgs::image_encodings::RGB8;
-        out_msg.image = inImage_;
-        image_pub_.publish(out_msg.toImageMsg());
+        markers[i].draw(inImage_, cv::Scalar(0, 0, 255), 2);
       }
 
-      // publish image after internal image processing
-      if (publishDebug)
+      // draw a 3D cube in each marker if there is 3D info
+      if (camParam_.isValid() && marker_size_ != -1)
       {
-        // show also the internal image resulting from the threshold operation
-        cv_bridge::CvImage debug_msg;
-        debug_msg.header.stamp = curr_stamp;
-        debug_msg.encoding = sensor_msgs::image_encodings::MONO8;
-        debug_msg.image = mDetector_.getThresholdedImage();
-        debug_pub_.publish(debug_msg.toImageMsg());
+        for (std::size_t i = 0; i < markers.size(); ++i)
+          aruco::CvDrawingUtils::draw3dAxis(inImage_, markers[i], camParam_);
       }
 
+      // show input with augmented information
+      cv_bridge::CvImage out_msg;
+      out_msg.header.stamp = curr_stamp;
+      out_msg.encoding = sensor_msgs::image_encodings::RGB8;
+      out_msg.image = inImage_;
+      image_pub_.publish(out_msg.toImageMsg());
     }
-    catch (cv_bridge::Exception& e)
+
+    // publish image after internal image processing
+    if (!detection.thresholded.empty())
     {
-      ROS_ERROR("cv_bridge exception: %s", e.what());
+      // show also the internal image resulting from the threshold operation
+      cv_bridge::CvImage debug_msg;
+      debug_msg.header.stamp = curr_stamp;
+      debug_msg.encoding = sensor_msgs::image_encodings::MONO8;
+      debug_msg.image = detection.thresholded;
+      debug_pub_.publish(debug_msg.toImageMsg());
     }
   }
+
+  // reports periodically the frames that were replaced in the queues because a stage was still busy
+  void reportDroppedFrames()
+  {
+    ros::WallTime now = ros::WallTime::now();
+    double elapsed = (now - lastDropReport_).toSec();
+    if (elapsed < 10.0)
+      return;
+
+    uint64_t imageDrops = images_.dropped(), detectionDrops = detections_.dropped();
+    if (imageDrops != reportedImageDrops_ || detectionDrops != reportedDetectionDrops_)
+      ROS_INFO_STREAM("In the last " << elapsed << " s, dropped " << imageDrops - reportedImageDrops_
+                      << " images waiting for detection and " << detectionDrops - reportedDetectionDrops_
+                      << " detections waiting to be published");
+    reportedImageDrops_ = imageDrops;
+    reportedDetectionDrops_ = detectionDrops;
+    lastDropReport_ = now;
+  }
 };
 
+#ifdef ARUCO_ROS_NODELET
+namespace aruco_ros
+{
+
+class MarkerPublisherNodelet : public nodelet::Nodelet
+{
+  boost::shared_ptr<ArucoMarkerPublisher> node_;
+
+  void onInit()
+  {
+    node_.reset(new ArucoMarkerPublisher(getPrivateNodeHandle()));
+  }
+};
+
+}
+
+PLUGINLIB_EXPORT_CLASS(aruco_ros::MarkerPublisherNodelet, nodelet::Nodelet)
+#else
 int main(int argc, char **argv)
 {
   ros::init(argc, argv, "aruco_marker_publisher");
 
   ArucoMarkerPublisher node;
 
-  ros::spin();
+  // the image callback only queues the images, the other callbacks do not have to wait for it
+  ros::AsyncSpinner spinner(2);
+  spinner.start();
+  ros::waitForShutdown();
 }
+#endif
@@ -0,0 +1,400 @@
+/*****************************
+ Copyright 2011 Rafael Muñoz Salinas. All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without modification, are
+ permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice, this list of
+ conditions and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ of conditions and the following disclaimer in the documentation and/or other materials
+ provided with the distribution.
+
+ THIS SOFTWARE IS PROVIDED BY Rafael Muñoz Salinas ''AS IS'' AND ANY EXPRESS OR IMPLIED
+ WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL Rafael Muñoz Salinas OR
+ CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+ The views and conclusions contained in the software and documentation are those of the
+ authors and should not be interpreted as representing official policies, either expressed
+ or implied, of Rafael Muñoz Salinas.
+ ********************************/
+/**
+ * @file multi_marker_publish.cpp
+ * @brief Version of marker_publish.cpp for several cameras in the same process. Each camera has its own detector,
+ * but all of them share the dictionary and a pool of worker threads, and the frames are scheduled in turns so that
+ * a busy camera cannot starve the rest.
+ */
+
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <aruco/aruco.h>
+#include <aruco/cvdrawingutils.h>
+#include <aruco/threadpool.h>
+
+#include <ros/ros.h>
+#include <image_transport/image_transport.h>
+#include <cv_bridge/cv_bridge.h>
+#include <sensor_msgs/image_encodings.h>
+#include <aruco_ros/aruco_ros_utils.h>
+#include <aruco_ros/detector_diagnostics.h>
+#include <aruco_ros/transform_cache.h>
+#include <aruco_msgs/MarkerArray.h>
+#include <tf/transform_listener.h>
+
+#ifdef ARUCO_ROS_NODELET
+#include <nodelet/nodelet.h>
+#include <pluginlib/class_list_macros.h>
+#endif
+
+class ArucoMultiMarkerPublisher
+{
+private:
+  // state of one camera. The members up to reportedDrops are protected by the mutex of the scheduler. The camera
+  // parameters are not modified after the first image is accepted
+  struct Camera
+  {
+    explicit Camera(tf::TransformListener& listener) :
+        camInfoReceived(false), busy(false), dropped(0), reportedDrops(0), cameraToReferenceCache(listener)
+    {
+    }
+
+    std::string name;
+    std::string cameraFrame;
+    aruco::CameraParameters camParam;
+    bool camInfoReceived;
+    sensor_msgs::ImageConstPtr pending; // latest image not processed yet
+    bool busy; // a worker is processing an image of this camera
+    uint64_t dropped, reportedDrops;
+
+    // only used by the worker processing the camera
+    aruco::MarkerDetector detector; // keeps the state of the camera, such as the marker size of DM_VIDEO_FAST
+    cv::Mat greyBuffer, inImage;
+    aruco_ros::TransformCache cameraToReferenceCache;
+
+    ros::Subscriber camInfoSub;
+    image_transport::Subscriber imageSub;
+    ros::Publisher markerPub;
+    image_transport::Publisher imagePub;
+  };
+
+  // node params
+  bool useRectifiedImages_;
+  std::string reference_frame_;
+  double marker_size_;
+
+  ros::NodeHandle nh_, pnh_;
+  image_transport::ImageTransport it_, pit_;
+  tf::TransformListener tfListener_;
+  cv::Ptr<aruco::ThreadPool> pool_; // shared by the detectors of all the cameras
+  std::vector<std::unique_ptr<Camera>> cameras_;
+
+  // scheduler: each worker takes the next camera with an image pending, in turns
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::size_t nextCamera_;
+  bool stop_;
+  std::vector<std::thread> workers_;
+  ros::WallTime lastDropReport_;
+  aruco_ros::DetectorDiagnostics diagnostics_; // a status per camera
+
+public:
+  ArucoMultiMarkerPublisher(const ros::NodeHandle& nh = ros::NodeHandle(),
+                            const ros::NodeHandle& private_nh = ros::NodeHandle("~")) :
+      nh_(nh), pnh_(private_nh), it_(nh_), pit_(pnh_), nextCamera_(0), stop_(false),
+      diagnostics_(pnh_, pnh_.param("diagnostics_period", 1.0))
+  {
+    std::vector<std::string> cameraNames;
+    pnh_.getParam("cameras", cameraNames);
+    pnh_.param<double>("marker_size", marker_size_, 0.05);
+    pnh_.param<bool>("image_is_rectified", useRectifiedImages_, true);
+    pnh_.param<std::string>("reference_frame", reference_frame_, "");
+
+    std::string dictionary, detection_mode;
+    double error_correction_rate, min_marker_size;
+    int threads, parallel_cameras;
+    pnh_.param<std::string>("dictionary", dictionary, "ALL_DICTS");
+    pnh_.param<double>("error_correction_rate", error_correction_rate, 0);
+    pnh_.param<std::string>("detection_mode", detection_mode, "DM_NORMAL");
+    pnh_.param<double>("min_marker_size", min_marker_size, 0);
+    // workers helping with the candidates of a frame, -1 means one per core
+    pnh_.param<int>("threads", threads, -1);
+    // frames of different cameras processed at the same time
+    pnh_.param<int>("parallel_cameras", parallel_cameras, 1);
+
+    aruco::DetectionMode mode = aruco::DM_NORMAL;
+    if (detection_mode == "DM_FAST")
+      mode = aruco::DM_FAST;
+    else if (detection_mode == "DM_VIDEO_FAST")
+      mode = aruco::DM_VIDEO_FAST;
+    else if (detection_mode == "DM_TRACKING")
+      mode = aruco::DM_TRACKING;
+
+    if (cameraNames.empty())
+      ROS_ERROR("No cameras given in the ~cameras parameter");
+
+    // the dictionary is loaded once, the detectors get copies of the labeler that share its tables
+    cv::Ptr<aruco::MarkerLabeler> labeler = aruco::MarkerLabeler::create(dictionary,
+                                                                         std::to_string(error_correction_rate));
+    pool_ = cv::makePtr<aruco::ThreadPool>(threads);
+
+    for (std::size_t i = 0; i < cameraNames.size(); ++i)
+    {
+      cameras_.emplace_back(new Camera(tfListener_));
+      Camera& camera = *cameras_.back();
+      camera.name = cameraNames[i];
+      pnh_.param<std::string>(camera.name + "/camera_frame", camera.cameraFrame, "");
+
+      cv::Ptr<aruco::MarkerLabeler> cameraLabeler = labeler->clone();
+      camera.detector.setMarkerLabeler(cameraLabeler.empty() ? labeler : cameraLabeler);
+      if (cameraLabeler.empty())
+        labeler = aruco::MarkerLabeler::create(dictionary, std::to_string(error_correction_rate));
+      camera.detector.setDetectionMode(mode, min_marker_size);
+      camera.detector.setThreadPool(pool_);
+      diagnostics_.add(camera.name, camera.detector, [this, &camera]
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return camera.dropped;
+      });
+    }
+
+    // subscribe once all the cameras are created, the callbacks may be called right away in a nodelet
+    lastDropReport_ = ros::WallTime::now();
+    for (std::size_t i = 0; i < cameras_.size(); ++i)
+    {
+      Camera& camera = *cameras_[i];
+      camera.markerPub = pnh_.advertise<aruco_msgs::MarkerArray>(camera.name + "/markers", 100);
+      camera.imagePub = pit_.advertise(camera.name + "/result", 1);
+      camera.camInfoSub = nh_.subscribe<sensor_msgs::CameraInfo>(
+          camera.name + "/camera_info", 1, boost::bind(&ArucoMultiMarkerPublisher::cam_info_callback, this, _1, i));
+      camera.imageSub = it_.subscribe(camera.name + "/image", 1,
+                                      boost::bind(&ArucoMultiMarkerPublisher::image_callback, this, _1, i));
+    }
+
+    ROS_INFO_STREAM("ArUco node started for " << cameras_.size() << " cameras with " << pool_->size()
+                    << " shared workers, processing " << parallel_cameras << " cameras at the same time");
+
+    for (int i = 0; i < std::max(1, parallel_cameras); ++i)
+      workers_.emplace_back(&ArucoMultiMarkerPublisher::workerLoop, this);
+  }
+
+  ~ArucoMultiMarkerPublisher()
+  {
+    // no callback may run once the members start being destroyed (mutex_ and cond_ are declared after cameras_).
+    // Not under mutex_, which the callbacks in progress, waited for by shutdown(), may be locking
+    for (auto& camera : cameras_)
+    {
+      camera->imageSub.shutdown();
+      camera->camInfoSub.shutdown();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cond_.notify_all();
+    for (auto& worker : workers_)
+      worker.join();
+  }
+
+  // wait for one camerainfo, then shut down that subscriber
+  void cam_info_callback(const sensor_msgs::CameraInfoConstPtr& msg, std::size_t cameraIdx)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Camera& camera = *cameras_[cameraIdx];
+    if (camera.camInfoReceived)
+      return;
+    camera.camParam = aruco_ros::rosCameraInfo2ArucoCamParams(*msg, useRectifiedImages_);
+    if (camera.cameraFrame.empty())
+      camera.cameraFrame = msg->header.frame_id;
+    camera.camInfoReceived = true;
+    camera.camInfoSub.shutdown();
+  }
+
+  void image_callback(const sensor_msgs::ImageConstPtr& msg, std::size_t cameraIdx)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      Camera& camera = *cameras_[cameraIdx];
+      if (!camera.camInfoReceived)
+        return;
+      if (camera.pending)
+        ++camera.dropped;
+      camera.pending = msg;
+      reportDroppedFrames();
+    }
+    cond_.notify_one();
+  }
+
+  void workerLoop()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+      Camera* camera = nullptr;
+      cond_.wait(lock, [this, &camera]
+      { return stop_ || (camera = nextReadyCamera()) != nullptr;});
+      if (stop_)
+        return;
+
+      sensor_msgs::ImageConstPtr msg;
+      msg.swap(camera->pending);
+      camera->busy = true;
+      lock.unlock();
+
+      try
+      {
+        process(*camera, msg);
+      }
+      catch (cv_bridge::Exception& e)
+      {
+        ROS_ERROR("cv_bridge exception: %s", e.what());
+      }
+      catch (cv::Exception& e)
+      {
+        ROS_ERROR_STREAM("Error processing the image of " << camera->name << ": " << e.what());
+      }
+
+      lock.lock();
+      camera->busy = false;
+      // the camera may have a new image, which this worker or another one can take now
+      cond_.notify_one();
+    }
+  }
+
+  // round robin over the cameras that have an image and are not being processed. Called with mutex_ locked
+  Camera* nextReadyCamera()
+  {
+    for (std::size_t i = 0; i < cameras_.size(); ++i)
+    {
+      std::size_t idx = (nextCamera_ + i) % cameras_.size();
+      if (cameras_[idx]->pending && !cameras_[idx]->busy)
+      {
+        nextCamera_ = idx + 1;
+        return cameras_[idx].get();
+      }
+    }
+    return nullptr;
+  }
+
+  void process(Camera& camera, const sensor_msgs::ImageConstPtr& msg)
+  {
+    bool publishMarkers = camera.markerPub.getNumSubscribers() > 0;
+    bool publishImage = camera.imagePub.getNumSubscribers() > 0;
+    if (!publishMarkers && !publishImage)
+      return;
+
+    std::vector<aruco::Marker> markers;
+    camera.detector.detect(aruco_ros::toGreyImage(msg, camera.greyBuffer), markers, camera.camParam, marker_size_,
+                           false);
+    ros::Time curr_stamp = msg->header.stamp;
+
+    if (publishMarkers)
+    {
+      std::string referenceFrame = reference_frame_.empty() ? camera.cameraFrame : reference_frame_;
+      tf::StampedTransform cameraToReference;
+      cameraToReference.setIdentity();
+      if (!markers.empty())
+        camera.cameraToReferenceCache.lookup(referenceFrame, camera.cameraFrame, cameraToReference);
+
+      aruco_msgs::MarkerArray::Ptr markerMsg(new aruco_msgs::MarkerArray());
+      markerMsg->header.frame_id = referenceFrame;
+      markerMsg->header.stamp = curr_stamp;
+      markerMsg->markers.resize(markers.size());
+      for (std::size_t i = 0; i < markers.size(); ++i)
+      {
+        aruco_msgs::Marker& marker_i = markerMsg->markers[i];
+        marker_i.header = markerMsg->header;
+        marker_i.id = markers[i].id;
+        marker_i.confidence = 1.0;
+        tf::Transform transform = static_cast<tf::Transform>(cameraToReference)
+            * aruco_ros::arucoMarker2Tf(markers[i]);
+        tf::poseTFToMsg(transform, marker_i.pose.pose);
+        cv::Point2f center = markers[i].getCenter();
+        marker_i.pixel_center.x = center.x;
+        marker_i.pixel_center.y = center.y;
+        for (std::size_t c = 0; c < markers[i].size() && c < marker_i.pixel_corners.size(); ++c)
+        {
+          marker_i.pixel_corners[c].x = markers[i][c].x;
+          marker_i.pixel_corners[c].y = markers[i][c].y;
+        }
+      }
+      camera.markerPub.publish(markerMsg);
+    }
+
+    // publish input image with markers drawn on it
+    if (publishImage)
+    {
+      camera.inImage = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8)->image;
+      for (std::size_t i = 0; i < markers.size(); ++i)
+      {
+        markers[i].draw(camera.inImage, cv::Scalar(0, 0, 255), 2);
+        if (camera.camParam.isValid() && marker_size_ != -1)
+          aruco::CvDrawingUtils::draw3dAxis(camera.inImage, markers[i], camera.camParam);
+      }
+
+      cv_bridge::CvImage out_msg;
+      out_msg.header.stamp = curr_stamp;
+      out_msg.encoding = sensor_msgs::image_encodings::RGB8;
+      out_msg.image = camera.inImage;
+      camera.imagePub.publish(out_msg.toImageMsg());
+    }
+  }
+
+  // reports periodically the images of each camera replaced before being processed. Called with mutex_ locked
+  void reportDroppedFrames()
+  {
+    ros::WallTime now = ros::WallTime::now();
+    double elapsed = (now - lastDropReport_).toSec();
+    if (elapsed < 10.0)
+      return;
+
+    for (auto& camera : cameras_)
+    {
+      if (camera->dropped != camera->reportedDrops)
+        ROS_INFO_STREAM("In the last " << elapsed << " s, dropped " << camera->dropped - camera->reportedDrops
+                        << " images of " << camera->name << " waiting for detection");
+      camera->reportedDrops = camera->dropped;
+    }
+    lastDropReport_ = now;
+  }
+};
+
+#ifdef ARUCO_ROS_NODELET
+namespace aruco_ros
+{
+
+class MultiMarkerPublisherNodelet : public nodelet::Nodelet
+{
+  boost::shared_ptr<ArucoMultiMarkerPublisher> node_;
+
+  void onInit()
+  {
+    node_.reset(new ArucoMultiMarkerPublisher(getNodeHandle(), getPrivateNodeHandle()));
+  }
+};
+
+}
+
+PLUGINLIB_EXPORT_CLASS(aruco_ros::MultiMarkerPublisherNodelet, nodelet::Nodelet)
+#else
+int main(int argc, char **argv)
+{
+  ros::init(argc, argv, "aruco_multi_marker_publisher");
+
+  ArucoMultiMarkerPublisher node;
+
+  // the image callbacks only queue the images, the detection runs in the workers of the node
+  ros::AsyncSpinner spinner(2);
+  spinner.start();
+  ros::waitForShutdown();
+}
+#endif
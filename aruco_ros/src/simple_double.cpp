@@ -43,225 +43,291 @@
 #include <cv_bridge/cv_bridge.h>
 #include <sensor_msgs/image_encodings.h>
 #include <aruco_ros/aruco_ros_utils.h>
+#include <aruco_ros/detector_diagnostics.h>
 #include <tf/transform_broadcaster.h>
 #include <tf/transform_datatypes.h>
 
 #include <dynamic_reconfigure/server.h>
 #include <aruco_ros/ArucoThresholdConfig.h>
 
-cv::Mat inImage;
-aruco::CameraParameters camParam;
-bool useRectifiedImages, normalizeImageIllumination;
-int dctComponentsToRemove;
-aruco::MarkerDetector mDetector;
-std::vector<aruco::Marker> markers;
-ros::Subscriber cam_info_sub;
-bool cam_info_received;
-image_transport::Publisher image_pub;
-image_transport::Publisher debug_pub;
-ros::Publisher pose_pub1;
-ros::Publisher pose_pub2;
-std::string child_name1;
-std::string parent_name;
-std::string child_name2;
-
-double marker_size;
-int marker_id1;
-int marker_id2;
-
-void image_callback(const sensor_msgs::ImageConstPtr& msg)
+#ifdef ARUCO_ROS_NODELET
+#include <nodelet/nodelet.h>
+#include <pluginlib/class_list_macros.h>
+#endif
+
+class ArucoDouble
 {
-  double ticksBefore = cv::getTickCount();
-  static tf::TransformBroadcaster br;
-  if (cam_info_received)
+private:
+  cv::Mat inImage, greyBuffer;
+  aruco::CameraParameters camParam;
+  bool useRectifiedImages, normalizeImageIllumination;
+  int dctComponentsToRemove;
+  aruco::MarkerDetector mDetector;
+  std::vector<aruco::Marker> markers;
+  ros::Subscriber cam_info_sub;
+  bool cam_info_received;
+  image_transport::Publisher image_pub;
+  image_transport::Publisher debug_pub;
+  ros::Publisher pose_pub1;
+  ros::Publisher pose_pub2;
+  std::string child_name1;
+  std::string parent_name;
+  std::string child_name2;
+
+  double marker_size;
+  int marker_id1;
+  int marker_id2;
+
+  ros::NodeHandle nh;
+  image_transport::ImageTransport it;
+  image_transport::Subscriber image_sub;
+
+  dynamic_reconfigure::Server<aruco_ros::ArucoThresholdConfig> dyn_rec_server;
+  aruco_ros::DetectorDiagnostics diagnostics;
+
+public:
+  explicit ArucoDouble(const ros::NodeHandle& private_nh = ros::NodeHandle("~")) :
+      cam_info_received(false), nh(private_nh), it(nh), dyn_rec_server(nh),
+      diagnostics(nh, nh.param("diagnostics_period", 1.0))
   {
-    ros::Time curr_stamp = msg->header.stamp;
-    cv_bridge::CvImagePtr cv_ptr;
-    try
+    dyn_rec_server.setCallback(boost::bind(&ArucoDouble::reconf_callback, this, _1, _2));
+
+    normalizeImageIllumination = false;
+
+    nh.param<bool>("image_is_rectified", useRectifiedImages, true);
+    ROS_INFO_STREAM("Image is rectified: " << useRectifiedImages);
+
+    image_sub = it.subscribe("/image", 1, &ArucoDouble::image_callback, this);
+    cam_info_sub = nh.subscribe("/camera_info", 1, &ArucoDouble::cam_info_callback, this);
+
+    image_pub = it.advertise("result", 1);
+    debug_pub = it.advertise("debug", 1);
+    pose_pub1 = nh.advertise<geometry_msgs::Pose>("pose", 100);
+    pose_pub2 = nh.advertise<geometry_msgs::Pose>("pose2", 100);
+
+    nh.param<double>("marker_size", marker_size, 0.05);
+    nh.param<int>("marker_id1", marker_id1, 582);
+    nh.param<int>("marker_id2", marker_id2, 26);
+    // if set, the rest of the markers are discarded as soon as they are identified, so they are neither refined
+    // nor drawn in the result image. Off by default, so that all the detected markers are drawn
+    bool detect_only_marker_ids;
+    nh.param<bool>("detect_only_marker_ids", detect_only_marker_ids, false);
+    if (detect_only_marker_ids)
     {
-      cv_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8);
-      inImage = cv_ptr->image;
+      aruco::MarkerIdFilter filter;
+      filter.add(marker_id1);
+      filter.add(marker_id2);
+      mDetector.setMarkerIdFilter(filter);
+    }
+    nh.param<bool>("normalizeImage", normalizeImageIllumination, true);
+    nh.param<int>("dct_components_to_remove", dctComponentsToRemove, 2);
+    if (dctComponentsToRemove == 0)
+      normalizeImageIllumination = false;
+    nh.param<std::string>("parent_name", parent_name, "");
+    nh.param<std::string>("child_name1", child_name1, "");
+    nh.param<std::string>("child_name2", child_name2, "");
+
+    diagnostics.add("detector", mDetector);
+  }
 
-      if (normalizeImageIllumination)
-      {
-        ROS_WARN("normalizeImageIllumination is unimplemented!");
-//        cv::Mat inImageNorm;
-//        pal_vision_util::dctNormalization(inImage, inImageNorm, dctComponentsToRemove);
-//        inImage = inImageNorm;
-      }
+  // checks the parameters, returns false if the node can not work
+  bool init()
+  {
+    if (parent_name == "" || child_name1 == "" || child_name2 == "")
+    {
+      ROS_ERROR("parent_name and/or child_name was not set!");
+      return false;
+    }
 
-      // detection results will go into "markers"
-      markers.clear();
-      // ok, let's detect
-      mDetector.detect(inImage, markers, camParam, marker_size, false);
-      // for each marker, draw info and its boundaries in the image
-      for (unsigned int i = 0; i < markers.size(); ++i)
+    ROS_INFO("ArUco node started with marker size of %f meters and marker ids to track: %d, %d", marker_size,
+             marker_id1, marker_id2);
+    ROS_INFO("ArUco node will publish pose to TF with (%s, %s) and (%s, %s) as (parent,child).", parent_name.c_str(),
+             child_name1.c_str(), parent_name.c_str(), child_name2.c_str());
+    return true;
+  }
+
+  void image_callback(const sensor_msgs::ImageConstPtr& msg)
+  {
+    double ticksBefore = cv::getTickCount();
+    static tf::TransformBroadcaster br;
+    if (cam_info_received)
+    {
+      ros::Time curr_stamp = msg->header.stamp;
+      try
       {
-        // only publishing the selected marker
-        if (markers[i].id == marker_id1)
+        cv::Mat grey = aruco_ros::toGreyImage(msg, greyBuffer);
+
+        // the color image is only needed to draw on it
+        bool drawImage = image_pub.getNumSubscribers() > 0;
+        if (drawImage)
+          inImage = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8)->image;
+
+        if (normalizeImageIllumination)
         {
-          tf::Transform transform = aruco_ros::arucoMarker2Tf(markers[i]);
-          br.sendTransform(tf::StampedTransform(transform, curr_stamp, parent_name, child_name1));
-          geometry_msgs::Pose poseMsg;
-          tf::poseTFToMsg(transform, poseMsg);
-          pose_pub1.publish(poseMsg);
+          ROS_WARN("normalizeImageIllumination is unimplemented!");
+  //        cv::Mat inImageNorm;
+  //        pal_vision_util::dctNormalization(inImage, inImageNorm, dctComponentsToRemove);
+  //        inImage = inImageNorm;
         }
-        else if (markers[i].id == marker_id2)
+
+        // detection results will go into "markers"
+        markers.clear();
+        // ok, let's detect
+        mDetector.detect(grey, markers, camParam, marker_size, false);
+        // for each marker, draw info and its boundaries in the image
+        for (unsigned int i = 0; i < markers.size(); ++i)
         {
-          tf::Transform transform = aruco_ros::arucoMarker2Tf(markers[i]);
-          br.sendTransform(tf::StampedTransform(transform, curr_stamp, parent_name, child_name2));
-          geometry_msgs::Pose poseMsg;
-          tf::poseTFToMsg(transform, poseMsg);
-          pose_pub2.publish(poseMsg);
+          // only publishing the selected marker
+          if (markers[i].id == marker_id1)
+          {
+            tf::Transform transform = aruco_ros::arucoMarker2Tf(markers[i]);
+            br.sendTransform(tf::StampedTransform(transform, curr_stamp, parent_name, child_name1));
+            geometry_msgs::Pose poseMsg;
+            tf::poseTFToMsg(transform, poseMsg);
+            pose_pub1.publish(poseMsg);
+          }
+          else if (markers[i].id == marker_id2)
+          {
+            tf::Transform transform = aruco_ros::arucoMarker2Tf(markers[i]);
+            br.sendTransform(tf::StampedTransform(transform, curr_stamp, parent_name, child_name2));
+            geometry_msgs::Pose poseMsg;
+            tf::poseTFToMsg(transform, poseMsg);
+            pose_pub2.publish(poseMsg);
+          }
+
+          // but drawing all the detected markers
+          if (drawImage)
+            markers[i].draw(inImage, cv::Scalar(0, 0, 255), 2);
         }
 
-        // but drawing all the detected markers
-        markers[i].draw(inImage, cv::Scalar(0, 0, 255), 2);
-      }
-
-      // paint a circle in the center of the image
-      cv::circle(inImage, cv::Point(inImage.cols / 2, inImage.rows / 2), 4, cv::Scalar(0, 255, 0), 1);
+        // paint a circle in the center of the image
+        if (drawImage)
+          cv::circle(inImage, cv::Point(inImage.cols / 2, inImage.rows / 2), 4, cv::Scalar(0, 255, 0), 1);
 
-      if (markers.size() == 2)
-      {
-        float x[2], y[2], u[2], v[2];
-        for (unsigned int i = 0; i < 2; ++i)
+        if (markers.size() == 2)
         {
-          ROS_DEBUG_STREAM(
-              "Marker(" << i << ") at camera coordinates = (" << markers[i].Tvec.at<float>(0,0) << ", " << markers[i].Tvec.at<float>(1,0) << ", " << markers[i].Tvec.at<float>(2,0));
-          // normalized coordinates of the marker
-          x[i] = markers[i].Tvec.at<float>(0, 0) / markers[i].Tvec.at<float>(2, 0);
-          y[i] = markers[i].Tvec.at<float>(1, 0) / markers[i].Tvec.at<float>(2, 0);
-          // undistorted pixel
-          u[i] = x[i] * camParam.CameraMatrix.at<float>(0, 0) + camParam.CameraMatrix.at<float>(0, 2);
-          v[i] = y[i] * camParam.CameraMatrix.at<float>(1, 1) + camParam.CameraMatrix.at<float>(1, 2);
-        }
+          float x[2], y[2], u[2], v[2];
+          for (unsigned int i = 0; i < 2; ++i)
+          {
+            ROS_DEBUG_STREAM(
+                "Marker(" << i << ") at camera coordinates = (" << markers[i].Tvec.at<float>(0,0) << ", " << markers[i].Tvec.at<float>(1,0) << ", " << markers[i].Tvec.at<float>(2,0));
+            // normalized coordinates of the marker
+            x[i] = markers[i].Tvec.at<float>(0, 0) / markers[i].Tvec.at<float>(2, 0);
+            y[i] = markers[i].Tvec.at<float>(1, 0) / markers[i].Tvec.at<float>(2, 0);
+            // undistorted pixel
+            u[i] = x[i] * camParam.CameraMatrix.at<float>(0, 0) + camParam.CameraMatrix.at<float>(0, 2);
+            v[i] = y[i] * camParam.CameraMatrix.at<float>(1, 1) + camParam.CameraMatrix.at<float>(1, 2);
+          }
 
-        ROS_DEBUG_STREAM(
-            "Mid point between the two markers in the image = (" << (x[0]+x[1])/2 << ", " << (y[0]+y[1])/2 << ")");
+          ROS_DEBUG_STREAM(
+              "Mid point between the two markers in the image = (" << (x[0]+x[1])/2 << ", " << (y[0]+y[1])/2 << ")");
+
+  //        // paint a circle in the mid point of the normalized coordinates of both markers
+  //        cv::circle(inImage, cv::Point((u[0] + u[1]) / 2, (v[0] + v[1]) / 2), 3, cv::Scalar(0, 0, 255), cv::FILLED);
+
+          // compute the midpoint in 3D:
+          float midPoint3D[3]; // 3D point
+          for (unsigned int i = 0; i < 3; ++i)
+            midPoint3D[i] = (markers[0].Tvec.at<float>(i, 0) + markers[1].Tvec.at<float>(i, 0)) / 2;
+          // now project the 3D mid point to normalized coordinates
+          float midPointNormalized[2];
+          midPointNormalized[0] = midPoint3D[0] / midPoint3D[2]; //x
+          midPointNormalized[1] = midPoint3D[1] / midPoint3D[2]; //y
+          u[0] = midPointNormalized[0] * camParam.CameraMatrix.at<float>(0, 0) + camParam.CameraMatrix.at<float>(0, 2);
+          v[0] = midPointNormalized[1] * camParam.CameraMatrix.at<float>(1, 1) + camParam.CameraMatrix.at<float>(1, 2);
 
-//        // paint a circle in the mid point of the normalized coordinates of both markers
-//        cv::circle(inImage, cv::Point((u[0] + u[1]) / 2, (v[0] + v[1]) / 2), 3, cv::Scalar(0, 0, 255), cv::FILLED);
+          ROS_DEBUG_STREAM(
+              "3D Mid point between the two markers in undistorted pixel coordinates = (" << u[0] << ", " << v[0] << ")");
 
-        // compute the midpoint in 3D:
-        float midPoint3D[3]; // 3D point
-        for (unsigned int i = 0; i < 3; ++i)
-          midPoint3D[i] = (markers[0].Tvec.at<float>(i, 0) + markers[1].Tvec.at<float>(i, 0)) / 2;
-        // now project the 3D mid point to normalized coordinates
-        float midPointNormalized[2];
-        midPointNormalized[0] = midPoint3D[0] / midPoint3D[2]; //x
-        midPointNormalized[1] = midPoint3D[1] / midPoint3D[2]; //y
-        u[0] = midPointNormalized[0] * camParam.CameraMatrix.at<float>(0, 0) + camParam.CameraMatrix.at<float>(0, 2);
-        v[0] = midPointNormalized[1] * camParam.CameraMatrix.at<float>(1, 1) + camParam.CameraMatrix.at<float>(1, 2);
+          // paint a circle in the mid point of the normalized coordinates of both markers
+          if (drawImage)
+            cv::circle(inImage, cv::Point(u[0], v[0]), 3, cv::Scalar(0, 0, 255), cv::FILLED);
 
-        ROS_DEBUG_STREAM(
-            "3D Mid point between the two markers in undistorted pixel coordinates = (" << u[0] << ", " << v[0] << ")");
+        }
 
-        // paint a circle in the mid point of the normalized coordinates of both markers
-        cv::circle(inImage, cv::Point(u[0], v[0]), 3, cv::Scalar(0, 0, 255), cv::FILLED);
+        // draw a 3D cube in each marker if there is 3D info
+        if (drawImage && camParam.isValid() && marker_size != -1)
+        {
+          for (unsigned int i = 0; i < markers.size(); ++i)
+          {
+            aruco::CvDrawingUtils::draw3dCube(inImage, markers[i], camParam);
+          }
+        }
 
-      }
+        if (drawImage)
+        {
+          // show input with augmented information
+          cv_bridge::CvImage out_msg;
+          out_msg.header.stamp = curr_stamp;
+          out_msg.encoding = sensor_msgs::image_encodings::RGB8;
+          out_msg.image = inImage;
+          image_pub.publish(out_msg.toImageMsg());
+        }
 
-      // draw a 3D cube in each marker if there is 3D info
-      if (camParam.isValid() && marker_size != -1)
-      {
-        for (unsigned int i = 0; i < markers.size(); ++i)
+        if (debug_pub.getNumSubscribers() > 0)
         {
-          aruco::CvDrawingUtils::draw3dCube(inImage, markers[i], camParam);
+          // show also the internal image resulting from the threshold operation
+          cv_bridge::CvImage debug_msg;
+          debug_msg.header.stamp = curr_stamp;
+          debug_msg.encoding = sensor_msgs::image_encodings::MONO8;
+          debug_msg.image = mDetector.getThresholdedImage();
+          debug_pub.publish(debug_msg.toImageMsg());
         }
-      }
 
-      if (image_pub.getNumSubscribers() > 0)
-      {
-        // show input with augmented information
-        cv_bridge::CvImage out_msg;
-        out_msg.header.stamp = curr_stamp;
-        out_msg.encoding = sensor_msgs::image_encodings::RGB8;
-        out_msg.image = inImage;
-        image_pub.publish(out_msg.toImageMsg());
+        ROS_DEBUG("runtime: %f ms", 1000 * (cv::getTickCount() - ticksBefore) / cv::getTickFrequency());
       }
-
-      if (debug_pub.getNumSubscribers() > 0)
+      catch (cv_bridge::Exception& e)
       {
-        // show also the internal image resulting from the threshold operation
-        cv_bridge::CvImage debug_msg;
-        debug_msg.header.stamp = curr_stamp;
-        debug_msg.encoding = sensor_msgs::image_encodings::MONO8;
-        debug_msg.image = mDetector.getThresholdedImage();
-        debug_pub.publish(debug_msg.toImageMsg());
+        ROS_ERROR("cv_bridge exception: %s", e.what());
+        return;
       }
-
-      ROS_DEBUG("runtime: %f ms", 1000 * (cv::getTickCount() - ticksBefore) / cv::getTickFrequency());
-    }
-    catch (cv_bridge::Exception& e)
-    {
-      ROS_ERROR("cv_bridge exception: %s", e.what());
-      return;
     }
   }
-}
 
-// wait for one camerainfo, then shut down that subscriber
-void cam_info_callback(const sensor_msgs::CameraInfo &msg)
+  // wait for one camerainfo, then shut down that subscriber
+  void cam_info_callback(const sensor_msgs::CameraInfo &msg)
+  {
+    camParam = aruco_ros::rosCameraInfo2ArucoCamParams(msg, useRectifiedImages);
+    cam_info_received = true;
+    cam_info_sub.shutdown();
+  }
+
+  void reconf_callback(aruco_ros::ArucoThresholdConfig &config, std::uint32_t level)
+  {
+    mDetector.setDetectionMode(aruco::DetectionMode(config.detection_mode), config.min_image_size);
+    normalizeImageIllumination = config.normalizeImage;
+    dctComponentsToRemove = config.dctComponentsToRemove;
+  }
+};
+
+#ifdef ARUCO_ROS_NODELET
+namespace aruco_ros
 {
-  camParam = aruco_ros::rosCameraInfo2ArucoCamParams(msg, useRectifiedImages);
-  cam_info_received = true;
-  cam_info_sub.shutdown();
-}
 
-void reconf_callback(aruco_ros::ArucoThresholdConfig &config, std::uint32_t level)
+class DoubleNodelet : public nodelet::Nodelet
 {
-  mDetector.setDetectionMode(aruco::DetectionMode(config.detection_mode), config.min_image_size);
-  normalizeImageIllumination = config.normalizeImage;
-  dctComponentsToRemove = config.dctComponentsToRemove;
+  boost::shared_ptr<ArucoDouble> node_;
+
+  void onInit()
+  {
+    node_.reset(new ArucoDouble(getPrivateNodeHandle()));
+    if (!node_->init())
+      node_.reset();
+  }
+};
+
 }
 
+PLUGINLIB_EXPORT_CLASS(aruco_ros::DoubleNodelet, nodelet::Nodelet)
+#else
 int main(int argc, char **argv)
 {
   ros::init(argc, argv, "aruco_simple");
-  ros::NodeHandle nh("~");
-  image_transport::ImageTransport it(nh);
-
-  dynamic_reconfigure::Server<aruco_ros::ArucoThresholdConfig> server;
-  dynamic_reconfigure::Server<aruco_ros::ArucoThresholdConfig>::CallbackType f_;
-  f_ = boost::bind(&reconf_callback, _1, _2);
-  server.setCallback(f_);
-
-  normalizeImageIllumination = false;
-
-  nh.param<bool>("image_is_rectified", useRectifiedImages, true);
-  ROS_INFO_STREAM("Image is rectified: " << useRectifiedImages);
-
-  image_transport::Subscriber image_sub = it.subscribe("/image", 1, &image_callback);
-  cam_info_sub = nh.subscribe("/camera_info", 1, &cam_info_callback);
-
-  cam_info_received = false;
-  image_pub = it.advertise("result", 1);
-  debug_pub = it.advertise("debug", 1);
-  pose_pub1 = nh.advertise<geometry_msgs::Pose>("pose", 100);
-  pose_pub2 = nh.advertise<geometry_msgs::Pose>("pose2", 100);
-
-  nh.param<double>("marker_size", marker_size, 0.05);
-  nh.param<int>("marker_id1", marker_id1, 582);
-  nh.param<int>("marker_id2", marker_id2, 26);
-  nh.param<bool>("normalizeImage", normalizeImageIllumination, true);
-  nh.param<int>("dct_components_to_remove", dctComponentsToRemove, 2);
-  if (dctComponentsToRemove == 0)
-    normalizeImageIllumination = false;
-  nh.param<std::string>("parent_name", parent_name, "");
-  nh.param<std::string>("child_name1", child_name1, "");
-  nh.param<std::string>("child_name2", child_name2, "");
 
-  if (parent_name == "" || child_name1 == "" || child_name2 == "")
-  {
-    ROS_ERROR("parent_name and/or child_name was not set!");
+  ArucoDouble node;
+  if (!node.init())
     return -1;
-  }
-
-  ROS_INFO("ArUco node started with marker size of %f meters and marker ids to track: %d, %d", marker_size, marker_id1,
-           marker_id2);
-  ROS_INFO("ArUco node will publish pose to TF with (%s, %s) and (%s, %s) as (parent,child).", parent_name.c_str(),
-           child_name1.c_str(), parent_name.c_str(), child_name2.c_str());
 
   ros::spin();
 }
+#endif
@@ -42,6 +42,7 @@
 #include <cv_bridge/cv_bridge.h>
 #include <sensor_msgs/image_encodings.h>
 #include <aruco_ros/aruco_ros_utils.h>
+#include <aruco_ros/detector_diagnostics.h>
 #include <tf/transform_broadcaster.h>
 #include <tf/transform_listener.h>
 #include <visualization_msgs/Marker.h>
@@ -49,10 +50,15 @@
 #include <dynamic_reconfigure/server.h>
 #include <aruco_ros/ArucoThresholdConfig.h>
 
+#ifdef ARUCO_ROS_NODELET
+#include <nodelet/nodelet.h>
+#include <pluginlib/class_list_macros.h>
+#endif
+
 class ArucoSimple
 {
 private:
-  cv::Mat inImage;
+  cv::Mat inImage, greyBuffer;
   aruco::CameraParameters camParam;
   tf::StampedTransform rightToLeft;
   bool useRectifiedImages;
@@ -81,10 +87,12 @@ private:
   tf::TransformListener _tfListener;
 
   dynamic_reconfigure::Server<aruco_ros::ArucoThresholdConfig> dyn_rec_server;
+  aruco_ros::DetectorDiagnostics diagnostics;
 
 public:
-  ArucoSimple() :
-      cam_info_received(false), nh("~"), it(nh)
+  explicit ArucoSimple(const ros::NodeHandle& private_nh = ros::NodeHandle("~")) :
+      cam_info_received(false), nh(private_nh), it(nh), dyn_rec_server(nh),
+      diagnostics(nh, nh.param("diagnostics_period", 1.0))
   {
 
     if (nh.hasParam("corner_refinement"))
@@ -101,6 +109,9 @@ public:
       case aruco::MarkerDetector::ThresMethod::THRES_AUTO_FIXED:
         thresh_method = "THRESH_AUTO_FIXED";
         break;
+      case aruco::MarkerDetector::ThresMethod::THRES_ADAPTIVE_INTEGRAL:
+        thresh_method = "THRESH_ADAPTIVE_INTEGRAL";
+        break;
       default:
         thresh_method = "UNKNOWN";
         break;
@@ -118,6 +129,8 @@ public:
       mDetector.setDetectionMode(aruco::DM_FAST, min_marker_size);
     else if (detection_mode == "DM_VIDEO_FAST")
       mDetector.setDetectionMode(aruco::DM_VIDEO_FAST, min_marker_size);
+    else if (detection_mode == "DM_TRACKING")
+      mDetector.setDetectionMode(aruco::DM_TRACKING, min_marker_size);
     else
       // Aruco version 2 mode
       mDetector.setDetectionMode(aruco::DM_NORMAL, min_marker_size);
@@ -138,6 +151,16 @@ public:
 
     nh.param<double>("marker_size", marker_size, 0.05);
     nh.param<int>("marker_id", marker_id, 300);
+    // if set, the rest of the markers are discarded as soon as they are identified, so they are neither refined
+    // nor drawn in the result image. Off by default, so that all the detected markers are drawn
+    bool detect_only_marker_id;
+    nh.param<bool>("detect_only_marker_id", detect_only_marker_id, false);
+    if (detect_only_marker_id)
+    {
+      aruco::MarkerIdFilter filter;
+      filter.add(marker_id);
+      mDetector.setMarkerIdFilter(filter);
+    }
     nh.param<std::string>("reference_frame", reference_frame, "");
     nh.param<std::string>("camera_frame", camera_frame, "");
     nh.param<std::string>("marker_frame", marker_frame, "");
@@ -153,6 +176,8 @@ public:
              marker_frame.c_str());
 
     dyn_rec_server.setCallback(boost::bind(&ArucoSimple::reconf_callback, this, _1, _2));
+
+    diagnostics.add("detector", mDetector);
   }
 
   bool getTransform(const std::string& refFrame, const std::string& childFrame, tf::StampedTransform& transform)
@@ -197,16 +222,17 @@ public:
     if (cam_info_received)
     {
       ros::Time curr_stamp = msg->header.stamp;
-      cv_bridge::CvImagePtr cv_ptr;
       try
       {
-        cv_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8);
-        inImage = cv_ptr->image;
-
         // detection results will go into "markers"
         markers.clear();
         // ok, let's detect
-        mDetector.detect(inImage, markers, camParam, marker_size, false);
+        mDetector.detect(aruco_ros::toGreyImage(msg, greyBuffer), markers, camParam, marker_size, false);
+
+        // the color image is only needed to draw on it
+        bool drawImage = image_pub.getNumSubscribers() > 0;
+        if (drawImage)
+          inImage = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::RGB8)->image;
         // for each marker, draw info and its boundaries in the image
         for (std::size_t i = 0; i < markers.size(); ++i)
         {
@@ -268,11 +294,12 @@ public:
 
           }
           // but drawing all the detected markers
-          markers[i].draw(inImage, cv::Scalar(0, 0, 255), 2);
+          if (drawImage)
+            markers[i].draw(inImage, cv::Scalar(0, 0, 255), 2);
         }
 
         // draw a 3d cube in each marker if there is 3d info
-        if (camParam.isValid() && marker_size != -1)
+        if (drawImage && camParam.isValid() && marker_size != -1)
         {
           for (std::size_t i = 0; i < markers.size(); ++i)
           {
@@ -280,7 +307,7 @@ public:
           }
         }
 
-        if (image_pub.getNumSubscribers() > 0)
+        if (drawImage)
         {
           // show input with augmented information
           cv_bridge::CvImage out_msg;
@@ -332,6 +359,24 @@ public:
   }
 };
 
+#ifdef ARUCO_ROS_NODELET
+namespace aruco_ros
+{
+
+class SingleNodelet : public nodelet::Nodelet
+{
+  boost::shared_ptr<ArucoSimple> node_;
+
+  void onInit()
+  {
+    node_.reset(new ArucoSimple(getPrivateNodeHandle()));
+  }
+};
+
+}
+
+PLUGINLIB_EXPORT_CLASS(aruco_ros::SingleNodelet, nodelet::Nodelet)
+#else
 int main(int argc, char **argv)
 {
   ros::init(argc, argv, "aruco_simple");
@@ -340,3 +385,4 @@ int main(int argc, char **argv)
 
   ros::spin();
 }
+#endif
@@ -0,0 +1,110 @@
+#include <aruco_ros/transform_cache.h>
+#include <ros/console.h>
+
+aruco_ros::TransformCache::TransformCache(tf::TransformListener& listener) :
+    listener_(listener), valid_(false), static_(false), waiting_(false), stop_(false)
+{
+  waitThread_ = std::thread(&TransformCache::waitLoop, this);
+}
+
+aruco_ros::TransformCache::~TransformCache()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cond_.notify_all();
+  waitThread_.join();
+}
+
+bool aruco_ros::TransformCache::lookup(const std::string& reference_frame, const std::string& child_frame,
+                                       tf::StampedTransform& transform)
+{
+  if (reference_frame == child_frame)
+  {
+    transform.setIdentity();
+    transform.frame_id_ = reference_frame;
+    transform.child_frame_id_ = child_frame;
+    return true;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (reference_frame != reference_frame_ || child_frame != child_frame_)
+  {
+    reference_frame_ = reference_frame;
+    child_frame_ = child_frame;
+    valid_ = static_ = false;
+  }
+
+  // static transforms are latched, for the rest the latest one is taken
+  if (!static_ && !update() && !waiting_)
+  {
+    waiting_ = true;
+    lock.unlock();
+    cond_.notify_one();
+    lock.lock();
+  }
+
+  if (!valid_)
+  {
+    ROS_WARN_STREAM_THROTTLE(5.0, "Transform from " << child_frame << " to " << reference_frame
+                             << " not available yet");
+    return false;
+  }
+  transform = transform_;
+  return true;
+}
+
+bool aruco_ros::TransformCache::isStatic() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_;
+}
+
+bool aruco_ros::TransformCache::update()
+{
+  try
+  {
+    if (!listener_.canTransform(reference_frame_, child_frame_, ros::Time(0)))
+      return false;
+    listener_.lookupTransform(reference_frame_, child_frame_, ros::Time(0), transform_);
+  }
+  catch (const tf::TransformException& e)
+  {
+    ROS_ERROR_STREAM_THROTTLE(5.0, "Error in lookupTransform of " << child_frame_ << " in " << reference_frame_
+                              << ": " << e.what());
+    return false;
+  }
+  valid_ = true;
+  // the latest common time of a chain made only of static transforms is zero
+  static_ = transform_.stamp_.isZero();
+  if (static_)
+    ROS_INFO_STREAM("Transform from " << child_frame_ << " to " << reference_frame_ << " is static, caching it");
+  return true;
+}
+
+void aruco_ros::TransformCache::waitLoop()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+  {
+    cond_.wait(lock, [this]
+    { return waiting_ || stop_;});
+    if (stop_)
+      return;
+
+    // wait without holding the lock, so that lookup() keeps serving the last transform known
+    std::string reference_frame = reference_frame_, child_frame = child_frame_;
+    lock.unlock();
+    std::string errMsg;
+    bool available = listener_.waitForTransform(reference_frame, child_frame, ros::Time(0), ros::Duration(0.5),
+                                                ros::Duration(0.01), &errMsg);
+    lock.lock();
+
+    if (available && reference_frame == reference_frame_ && child_frame == child_frame_)
+      update();
+    else if (!available)
+      ROS_ERROR_STREAM_THROTTLE(5.0, "Unable to get pose from TF: " << errMsg);
+    waiting_ = false;
+  }
+}